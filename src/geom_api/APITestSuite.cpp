@@ -200,6 +200,62 @@ void APITestSuite::ChangePodParams()
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 }
 
+void APITestSuite::BatchPodParams()
+{
+    printf( "APITestSuite::BatchPodParams()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add Pod Geom =====//
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( pod_id.c_str() != NULL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    double start_max_x = vsp::GetGeomBBoxMax( pod_id ).x();
+
+    //==== Set Several Parms In Nested Batches, Even Forced Updates Wait For The Outer End ====//
+    double len_val = 7.0;
+    double x_loc_val = 3.0;
+
+    vsp::BeginParmBatch();
+    vsp::BeginParmBatch();
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Length", "Design", len_val ), len_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", x_loc_val ), x_loc_val, TEST_TOL );
+    vsp::EndParmBatch();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT_DELTA( vsp::GetParmVal( pod_id, "Length", "Design" ), len_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMax( pod_id ).x(), start_max_x, TEST_TOL );
+
+    vsp::EndParmBatch();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Committed ====//
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMin( pod_id ).x(), x_loc_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMax( pod_id ).x(), x_loc_val + len_val, TEST_TOL );
+
+    //==== Unmatched End Is Ignored ====//
+    vsp::EndParmBatch();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Renew Drops A Batch Left Open ====//
+    vsp::BeginParmBatch();
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 2.0 * len_val );
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Length", "Design", len_val ), len_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", x_loc_val ), x_loc_val, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMin( pod_id ).x(), x_loc_val, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMax( pod_id ).x(), x_loc_val + len_val, TEST_TOL );
+}
+
 //==== Use Case 1 =====//
 void APITestSuite::CopyPasteGeometry()
 {
@@ -25,6 +25,7 @@ public:
         TEST_ADD( APITestSuite::CreateGeometry )
         TEST_ADD( APITestSuite::CopyPasteSetTest )
         TEST_ADD( APITestSuite::ChangePodParams )
+        TEST_ADD( APITestSuite::BatchPodParams )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
@@ -49,6 +50,7 @@ private:
     void CreateGeometry();
     void CopyPasteSetTest();
     void ChangePodParams();
+    void BatchPodParams();
     void CopyPasteGeometry();
     // Analysis
     void CheckAnalysisMgr();
@@ -6322,6 +6322,22 @@ double SetParmValUpdate( const string & container_id, const string & parm_name,
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Start a parm batch.  Links, geoms, bounding box and GUI are updated once by EndParmBatch.
+void BeginParmBatch()
+{
+    Vehicle* veh = GetVehicle();
+    veh->BeginParmBatch();
+    ErrorMgr.NoError();
+}
+
+/// Commit the parm batch started by BeginParmBatch.
+void EndParmBatch()
+{
+    Vehicle* veh = GetVehicle();
+    veh->EndParmBatch();
+    ErrorMgr.NoError();
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
@@ -11,6 +11,8 @@
 #include "ParmMgr.h"
 #include "ScriptMgr.h"
 #include "APIErrorMgr.h"
+#include "VehicleMgr.h"
+#include "Vehicle.h"
 
 //===== Encode Variable Def =====//
 xmlNodePtr VarDef::EncodeXml( xmlNodePtr & node )
@@ -76,9 +78,16 @@ bool AdvLink::ValidateParms()
         }
     }
 
+    bool input_vars_changed = ( valid_input_vars.size() != m_InputVars.size() );
+
     m_InputVars.clear();
     m_InputVars = valid_input_vars;
 
+    if ( input_vars_changed )
+    {
+        AdvLinkMgr.InputVarsChanged();
+    }
+
     vector < VarDef > valid_output_vars;
 
     for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
@@ -127,9 +136,14 @@ bool AdvLink::DuplicateVarName( const string & name )
 void AdvLink::AddVar( const VarDef & pd, bool input_flag )
 {
     if ( input_flag )
+    {
         m_InputVars.push_back( pd );
+        AdvLinkMgr.InputVarsChanged();
+    }
     else
+    {
         m_OutputVars.push_back( pd );
+    }
 
 }
 
@@ -138,6 +152,7 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     if ( input_flag && index >= 0 && index < (int)m_InputVars.size() )
     {
         m_InputVars.erase( m_InputVars.begin() + index );
+        AdvLinkMgr.InputVarsChanged();
     }
     else if ( !input_flag && index >= 0 && index < (int)m_OutputVars.size() )
     {
@@ -150,6 +165,7 @@ void AdvLink::DeleteAllVars( bool input_flag )
     if ( input_flag )
     {
         m_InputVars.clear();
+        AdvLinkMgr.InputVarsChanged();
     }
     else
     {
@@ -196,6 +212,7 @@ bool AdvLink::BuildScript()
     string script;
 
     m_ValidScript = false;
+    m_Expr.Clear();
 
     //==== Find All Var Names ====//
     vector< string > var_vec;
@@ -279,6 +296,19 @@ bool AdvLink::BuildScript()
     }
 
     m_ValidScript = true;
+
+    //==== Compile Fast Path, Only For Code The Script Engine Accepted ====//
+    vector< string > in_names, out_names;
+    for ( int i = 0 ; i < (int)m_InputVars.size() ; i++ )
+    {
+        in_names.push_back( m_InputVars[i].m_VarName );
+    }
+    for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
+    {
+        out_names.push_back( m_OutputVars[i].m_VarName );
+    }
+    m_Expr.Compile( m_ScriptCode, in_names, out_names );
+
     return true;
 }
 
@@ -300,20 +330,50 @@ bool AdvLink::UpdateLink( const string & pid )
     if ( !run_link )
         return false;
 
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    RunLink();
 
     return true;
 }
 
 void AdvLink::ForceUpdate()
+{
+    RunLink();
+}
+
+//==== Run Compiled Expression Or Call Script ====//
+void AdvLink::RunLink()
 {
     AdvLinkMgr.SetActiveLink( this );
 
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    if ( !m_Expr.IsCompiled() )
+    {
+        //==== Call Script ====//
+        ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+        return;
+    }
+
+    //==== Same Steps As The Generated UpdateLink() ====//
+    const vector< string > & in_names = m_Expr.GetInputNames();
+    m_ExprInVals.resize( in_names.size() );
+    for ( int i = 0 ; i < (int)in_names.size() ; i++ )
+    {
+        m_ExprInVals[i] = GetVar( in_names[i] );
+    }
+
+    if ( !m_Expr.Evaluate( m_ExprInVals, m_ExprOutVals ) )
+    {
+        // The script stops here too, before it loads its outputs
+        printf( "An exception 'Divide by zero' occurred \n" );
+        return;
+    }
+
+    const vector< string > & out_names = m_Expr.GetOutputNames();
+    for ( int i = 0 ; i < (int)out_names.size() ; i++ )
+    {
+        SetVar( out_names[i], m_ExprOutVals[i] );
+    }
+
+    VehicleMgr.GetVehicle()->Update();
 }
 
 //==== Encode Contents of Adv Link Into XML Tree ====//
@@ -356,6 +416,7 @@ xmlNodePtr AdvLink::DecodeXml( xmlNodePtr & adv_link_node )
             xmlNodePtr var_def_node = XmlUtil::GetNode( input_node, "VarDef", i );
             m_InputVars[i].DecodeXml( var_def_node );
         }
+        AdvLinkMgr.InputVarsChanged();
 
         //==== Output Vars ====//
         xmlNodePtr output_node = XmlUtil::GetNode( adv_link_node, "OutputVars", 0 );
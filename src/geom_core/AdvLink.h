@@ -18,6 +18,7 @@
 
 #include "Parm.h"
 #include "ParmContainer.h"
+#include "AdvLinkExpr.h"
 
 using std::string;
 
@@ -91,6 +92,13 @@ protected:
 
     bool m_ValidScript;
     string m_ScriptErrors;
+
+    //==== Plain Arithmetic Scripts Are Evaluated Without The Script Engine ====//
+    AdvLinkExpr m_Expr;
+    vector< double > m_ExprInVals;
+    vector< double > m_ExprOutVals;
+
+    void RunLink();
      
 private:
 
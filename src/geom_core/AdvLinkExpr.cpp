@@ -0,0 +1,904 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+// AdvLinkExpr.cpp: implementation of the compiled advanced link expressions.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AdvLinkExpr.h"
+#include "Defines.h"
+
+#include <cmath>
+#include <cctype>
+#include <climits>
+
+//==== Constructor ====//
+AdvLinkExpr::AdvLinkExpr()
+{
+    m_Compiled = false;
+    m_Pos = 0;
+}
+
+//==== Clear ====//
+void AdvLinkExpr::Clear()
+{
+    m_Compiled = false;
+    m_InputNames.clear();
+    m_OutputNames.clear();
+    m_VarNames.clear();
+    m_VarVals.clear();
+    m_Ops.clear();
+    m_Stack.clear();
+    m_Tokens.clear();
+    m_Nodes.clear();
+    m_Pos = 0;
+}
+
+//==== Compile Script Code, Returns False If It Is Not Plain Arithmetic ====//
+bool AdvLinkExpr::Compile( const string & code, const vector< string > & input_names, const vector< string > & output_names )
+{
+    Clear();
+
+    m_InputNames = input_names;
+    m_OutputNames = output_names;
+
+    m_VarNames = input_names;
+    m_VarNames.insert( m_VarNames.end(), output_names.begin(), output_names.end() );
+
+    //==== Names Must Be Unique And Not Hide A Function ====//
+    for ( int i = 0 ; i < ( int )m_VarNames.size() ; i++ )
+    {
+        int num_args;
+        if ( FindFunction( m_VarNames[i], num_args ) >= 0 )
+        {
+            Clear();
+            return false;
+        }
+        for ( int j = 0 ; j < i ; j++ )
+        {
+            if ( m_VarNames[i] == m_VarNames[j] )
+            {
+                Clear();
+                return false;
+            }
+        }
+    }
+
+    if ( !Tokenize( code ) )
+    {
+        Clear();
+        return false;
+    }
+
+    m_Pos = 0;
+    while ( m_Tokens[m_Pos].m_Type != TOK_END )
+    {
+        if ( !ParseStatement() )
+        {
+            Clear();
+            return false;
+        }
+    }
+
+    //==== Inputs Start At Zero And Outputs Unset, As In The Generated Script ====//
+    m_VarVals.assign( m_VarNames.size(), 0.0 );
+    for ( int i = 0 ; i < ( int )output_names.size() ; i++ )
+    {
+        m_VarVals[ input_names.size() + i ] = -1.0e15;
+    }
+
+    m_Tokens.clear();
+    m_Nodes.clear();
+    m_Stack.reserve( 32 );
+
+    m_Compiled = true;
+    return true;
+}
+
+//==== Run The Statements, Returns False Where The Script Would Throw ====//
+bool AdvLinkExpr::Evaluate( const vector< double > & input_vals, vector< double > & output_vals )
+{
+    int num_in = ( int )m_InputNames.size();
+    int num_out = ( int )m_OutputNames.size();
+
+    for ( int i = 0 ; i < num_in && i < ( int )input_vals.size() ; i++ )
+    {
+        m_VarVals[i] = input_vals[i];
+    }
+
+    m_Stack.clear();
+    for ( int i = 0 ; i < ( int )m_Ops.size() ; i++ )
+    {
+        const ExprOp & op = m_Ops[i];
+        switch ( op.m_Code )
+        {
+        case OP_CONST:
+            m_Stack.push_back( op.m_Val );
+            break;
+        case OP_VAR:
+            m_Stack.push_back( m_VarVals[ op.m_Index ] );
+            break;
+        case OP_STORE:
+            m_VarVals[ op.m_Index ] = m_Stack.back();
+            m_Stack.pop_back();
+            break;
+        case OP_NEG:
+            m_Stack.back() = -m_Stack.back();
+            break;
+        case OP_ADD:
+        case OP_SUB:
+        case OP_MUL:
+        case OP_DIV:
+        {
+            double b = m_Stack.back();
+            m_Stack.pop_back();
+            double & a = m_Stack.back();
+            if ( op.m_Index == T_FLOAT )
+            {
+                float fa = ( float )a;
+                float fb = ( float )b;
+                if ( op.m_Code == OP_DIV && fb == 0.0f )
+                {
+                    return false;
+                }
+                if ( op.m_Code == OP_ADD )      a = fa + fb;
+                else if ( op.m_Code == OP_SUB ) a = fa - fb;
+                else if ( op.m_Code == OP_MUL ) a = fa * fb;
+                else                            a = fa / fb;
+            }
+            else
+            {
+                if ( op.m_Code == OP_DIV && b == 0.0 )
+                {
+                    return false;
+                }
+                if ( op.m_Code == OP_ADD )      a = a + b;
+                else if ( op.m_Code == OP_SUB ) a = a - b;
+                else if ( op.m_Code == OP_MUL ) a = a * b;
+                else                            a = a / b;
+            }
+            break;
+        }
+        case OP_CALL1:
+        {
+            // The script engine registers the float versions of the math functions
+            double & a = m_Stack.back();
+            float f = ( float )a;
+            float ipart;
+            switch ( op.m_Index )
+            {
+            case FN_COS:        a = cosf( f );            break;
+            case FN_SIN:        a = sinf( f );            break;
+            case FN_TAN:        a = tanf( f );            break;
+            case FN_ACOS:       a = acosf( f );           break;
+            case FN_ASIN:       a = asinf( f );           break;
+            case FN_ATAN:       a = atanf( f );           break;
+            case FN_COSH:       a = coshf( f );           break;
+            case FN_SINH:       a = sinhf( f );           break;
+            case FN_TANH:       a = tanhf( f );           break;
+            case FN_LOG:        a = logf( f );            break;
+            case FN_LOG10:      a = log10f( f );          break;
+            case FN_SQRT:       a = sqrtf( f );           break;
+            case FN_CEIL:       a = ceilf( f );           break;
+            case FN_ABS:        a = fabsf( f );           break;
+            case FN_FLOOR:      a = floorf( f );          break;
+            case FN_FRACTION:   a = modff( f, &ipart );   break;
+            case FN_RAD2DEG:    a = a * RAD_2_DEG;        break;
+            case FN_DEG2RAD:    a = a * DEG_2_RAD;        break;
+            }
+            break;
+        }
+        case OP_CALL2:
+        {
+            double b = m_Stack.back();
+            m_Stack.pop_back();
+            double & a = m_Stack.back();
+            switch ( op.m_Index )
+            {
+            case FN_ATAN2:      a = atan2f( ( float )a, ( float )b );     break;
+            case FN_POW:        a = powf( ( float )a, ( float )b );       break;
+            case FN_MIN:        a = ( a < b ) ? a : b;                    break;
+            case FN_MAX:        a = ( a > b ) ? a : b;                    break;
+            }
+            break;
+        }
+        }
+    }
+
+    output_vals.resize( num_out );
+    for ( int i = 0 ; i < num_out ; i++ )
+    {
+        output_vals[i] = m_VarVals[ num_in + i ];
+    }
+    return true;
+}
+
+//==== Split Code Into Tokens ====//
+bool AdvLinkExpr::Tokenize( const string & code )
+{
+    m_Tokens.clear();
+
+    const char* str = code.c_str();
+    size_t n = code.size();
+    size_t i = 0;
+
+    while ( i < n )
+    {
+        char c = str[i];
+
+        //==== White Space And Comments ====//
+        if ( c == ' ' || c == '\t' || c == '\n' || c == '\r' )
+        {
+            i++;
+            continue;
+        }
+        if ( c == '/' && i + 1 < n && str[i + 1] == '/' )
+        {
+            while ( i < n && str[i] != '\n' )
+            {
+                i++;
+            }
+            continue;
+        }
+        if ( c == '/' && i + 1 < n && str[i + 1] == '*' )
+        {
+            size_t end = code.find( "*/", i + 2 );
+            if ( end == string::npos )
+            {
+                return false;
+            }
+            i = end + 2;
+            continue;
+        }
+
+        ExprToken tok;
+        tok.m_Val = 0.0;
+        tok.m_IntVal = 0;
+
+        //==== Numbers, Decimal Only, Integers Stay Integers As In The Script ====//
+        if ( isdigit( c ) || ( c == '.' && i + 1 < n && isdigit( str[i + 1] ) ) )
+        {
+            size_t j = i;
+            bool real_flag = false;
+            while ( j < n && isdigit( str[j] ) )
+            {
+                j++;
+            }
+            if ( j < n && str[j] == '.' )
+            {
+                real_flag = true;
+                j++;
+                while ( j < n && isdigit( str[j] ) )
+                {
+                    j++;
+                }
+            }
+            if ( j < n && ( str[j] == 'e' || str[j] == 'E' ) )
+            {
+                real_flag = true;
+                j++;
+                if ( j < n && ( str[j] == '+' || str[j] == '-' ) )
+                {
+                    j++;
+                }
+                if ( j >= n || !isdigit( str[j] ) )
+                {
+                    return false;
+                }
+                while ( j < n && isdigit( str[j] ) )
+                {
+                    j++;
+                }
+            }
+
+            // Float suffixes, radix prefixes and digit separators are left to the script
+            if ( j < n && ( isalnum( str[j] ) || str[j] == '_' || str[j] == '\'' || str[j] == '.' ) )
+            {
+                return false;
+            }
+
+            if ( real_flag )
+            {
+                size_t num_scanned = 0;
+                tok.m_Type = TOK_NUM;
+                tok.m_Val = ScanDouble( str + i, num_scanned );
+                if ( num_scanned != j - i )
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if ( j - i > 10 )
+                {
+                    return false;
+                }
+                tok.m_Type = TOK_INT;
+                tok.m_IntVal = 0;
+                for ( size_t k = i ; k < j ; k++ )
+                {
+                    tok.m_IntVal = tok.m_IntVal * 10 + ( str[k] - '0' );
+                }
+                if ( tok.m_IntVal > INT_MAX )
+                {
+                    return false;
+                }
+            }
+
+            m_Tokens.push_back( tok );
+            i = j;
+            continue;
+        }
+
+        //==== Names ====//
+        if ( isalpha( c ) || c == '_' )
+        {
+            size_t j = i;
+            while ( j < n && ( isalnum( str[j] ) || str[j] == '_' ) )
+            {
+                j++;
+            }
+            tok.m_Type = TOK_NAME;
+            tok.m_Text = code.substr( i, j - i );
+            m_Tokens.push_back( tok );
+            i = j;
+            continue;
+        }
+
+        //==== Operators, Compound Ones (+=, ==, **, ++ ...) Are Left To The Script ====//
+        if ( c == '+' || c == '-' || c == '*' || c == '/' || c == '=' )
+        {
+            if ( i + 1 < n && ( str[i + 1] == '=' || str[i + 1] == c ) )
+            {
+                return false;
+            }
+        }
+        else if ( c != '(' && c != ')' && c != ',' && c != ';' )
+        {
+            return false;
+        }
+
+        tok.m_Type = TOK_CHAR;
+        tok.m_Text = string( 1, c );
+        m_Tokens.push_back( tok );
+        i++;
+    }
+
+    ExprToken end_tok;
+    end_tok.m_Type = TOK_END;
+    end_tok.m_Val = 0.0;
+    end_tok.m_IntVal = 0;
+    m_Tokens.push_back( end_tok );
+
+    return true;
+}
+
+//==== Check For Single Char Token And Step Past It ====//
+bool AdvLinkExpr::IsChar( char c )
+{
+    const ExprToken & tok = m_Tokens[m_Pos];
+    if ( tok.m_Type == TOK_CHAR && tok.m_Text[0] == c )
+    {
+        m_Pos++;
+        return true;
+    }
+    return false;
+}
+
+//==== Statement: ";", "var = expr;" or "double var = expr;" ====//
+bool AdvLinkExpr::ParseStatement()
+{
+    if ( IsChar( ';' ) )
+    {
+        return true;
+    }
+
+    if ( m_Tokens[m_Pos].m_Type != TOK_NAME )
+    {
+        return false;
+    }
+
+    int var = -1;
+    if ( m_Tokens[m_Pos].m_Text == "double" )
+    {
+        m_Pos++;
+        if ( m_Tokens[m_Pos].m_Type != TOK_NAME )
+        {
+            return false;
+        }
+
+        string name = m_Tokens[m_Pos].m_Text;
+        int num_args;
+        if ( name == "double" || FindVar( name ) >= 0 || FindFunction( name, num_args ) >= 0 )
+        {
+            return false;
+        }
+        m_Pos++;
+
+        if ( !IsChar( '=' ) )
+        {
+            return false;
+        }
+
+        // The local is only in scope after its initializer
+        m_Nodes.clear();
+        int node = ParseSum();
+        if ( node < 0 || !IsChar( ';' ) )
+        {
+            return false;
+        }
+
+        m_VarNames.push_back( name );
+        var = ( int )m_VarNames.size() - 1;
+        Emit( node );
+    }
+    else
+    {
+        var = FindVar( m_Tokens[m_Pos].m_Text );
+        if ( var < 0 )
+        {
+            return false;
+        }
+        m_Pos++;
+
+        if ( !IsChar( '=' ) )
+        {
+            return false;
+        }
+
+        m_Nodes.clear();
+        int node = ParseSum();
+        if ( node < 0 || !IsChar( ';' ) )
+        {
+            return false;
+        }
+        Emit( node );
+    }
+
+    ExprOp op;
+    op.m_Code = OP_STORE;
+    op.m_Index = var;
+    op.m_Val = 0.0;
+    m_Ops.push_back( op );
+
+    return true;
+}
+
+//==== Sum: product { (+|-) product } ====//
+int AdvLinkExpr::ParseSum()
+{
+    int a = ParseProduct();
+    while ( a >= 0 )
+    {
+        if ( IsChar( '+' ) )
+        {
+            a = AddNode( OP_ADD, a, ParseProduct() );
+        }
+        else if ( IsChar( '-' ) )
+        {
+            a = AddNode( OP_SUB, a, ParseProduct() );
+        }
+        else
+        {
+            break;
+        }
+    }
+    return a;
+}
+
+//==== Product: unary { (*|/) unary } ====//
+int AdvLinkExpr::ParseProduct()
+{
+    int a = ParseUnary();
+    while ( a >= 0 )
+    {
+        if ( IsChar( '*' ) )
+        {
+            a = AddNode( OP_MUL, a, ParseUnary() );
+        }
+        else if ( IsChar( '/' ) )
+        {
+            a = AddNode( OP_DIV, a, ParseUnary() );
+        }
+        else
+        {
+            break;
+        }
+    }
+    return a;
+}
+
+//==== Unary: (+|-) unary | primary ====//
+int AdvLinkExpr::ParseUnary()
+{
+    if ( IsChar( '-' ) )
+    {
+        return AddNode( OP_NEG, ParseUnary(), -1 );
+    }
+    if ( IsChar( '+' ) )
+    {
+        return ParseUnary();
+    }
+    return ParsePrimary();
+}
+
+//==== Primary: number | var | function( args ) | ( sum ) ====//
+int AdvLinkExpr::ParsePrimary()
+{
+    const ExprToken tok = m_Tokens[m_Pos];
+
+    if ( tok.m_Type == TOK_NUM || tok.m_Type == TOK_INT )
+    {
+        m_Pos++;
+        ExprNode node;
+        node.m_Code = OP_CONST;
+        node.m_Index = -1;
+        node.m_Type = ( tok.m_Type == TOK_INT ) ? T_INT : T_DOUBLE;
+        node.m_Val = tok.m_Val;
+        node.m_IntVal = tok.m_IntVal;
+        node.m_A = -1;
+        node.m_B = -1;
+        m_Nodes.push_back( node );
+        return ( int )m_Nodes.size() - 1;
+    }
+
+    if ( tok.m_Type == TOK_NAME )
+    {
+        m_Pos++;
+
+        int num_args = 0;
+        int fn = FindFunction( tok.m_Text, num_args );
+        if ( fn >= 0 )
+        {
+            if ( !IsChar( '(' ) )
+            {
+                return -1;
+            }
+            int a = ParseSum();
+            int b = -1;
+            if ( num_args == 2 )
+            {
+                if ( a < 0 || !IsChar( ',' ) )
+                {
+                    return -1;
+                }
+                b = ParseSum();
+                if ( b < 0 )
+                {
+                    return -1;
+                }
+            }
+            if ( a < 0 || !IsChar( ')' ) )
+            {
+                return -1;
+            }
+
+            //==== Math Functions Take And Return Float, The VSP Ones Double ====//
+            int type = ( fn >= FN_MIN ) ? T_DOUBLE : T_FLOAT;
+            ConvertConst( a, type );
+            if ( b >= 0 )
+            {
+                ConvertConst( b, type );
+            }
+
+            int node = AddNode( num_args == 2 ? OP_CALL2 : OP_CALL1, a, b );
+            m_Nodes[node].m_Index = fn;
+            m_Nodes[node].m_Type = type;
+            return node;
+        }
+
+        int var = FindVar( tok.m_Text );
+        if ( var < 0 )
+        {
+            return -1;
+        }
+
+        ExprNode node;
+        node.m_Code = OP_VAR;
+        node.m_Index = var;
+        node.m_Type = T_DOUBLE;
+        node.m_Val = 0.0;
+        node.m_IntVal = 0;
+        node.m_A = -1;
+        node.m_B = -1;
+        m_Nodes.push_back( node );
+        return ( int )m_Nodes.size() - 1;
+    }
+
+    if ( IsChar( '(' ) )
+    {
+        int a = ParseSum();
+        if ( a < 0 || !IsChar( ')' ) )
+        {
+            return -1;
+        }
+        return a;
+    }
+
+    return -1;
+}
+
+//==== Add Operator Node, Typing And Folding Constants The Way The Script Compiler Does ====//
+int AdvLinkExpr::AddNode( int code, int a, int b )
+{
+    bool binary_flag = ( code == OP_ADD || code == OP_SUB || code == OP_MUL || code == OP_DIV || code == OP_CALL2 );
+    if ( a < 0 || ( binary_flag && b < 0 ) )
+    {
+        return -1;
+    }
+
+    //==== Arithmetic Is Done In The Wider Operand Type ====//
+    int type = T_DOUBLE;
+    if ( code != OP_CALL1 && code != OP_CALL2 )
+    {
+        int ta = m_Nodes[a].m_Type;
+        int tb = ( b >= 0 ) ? m_Nodes[b].m_Type : ta;
+
+        if ( ta == T_INT && tb == T_INT )
+        {
+            return FoldInt( code, a, b );
+        }
+
+        bool const_a = ( m_Nodes[a].m_Code == OP_CONST );
+        bool const_b = ( b >= 0 ) ? ( m_Nodes[b].m_Code == OP_CONST ) : const_a;
+
+        type = ( ta == T_DOUBLE || tb == T_DOUBLE ) ? T_DOUBLE : T_FLOAT;
+
+        // A double constant used with a float value is narrowed to float
+        if ( ( const_a && ta == T_DOUBLE && !const_b && tb == T_FLOAT ) ||
+             ( const_b && tb == T_DOUBLE && !const_a && ta == T_FLOAT ) )
+        {
+            type = T_FLOAT;
+        }
+
+        ConvertConst( a, type );
+        if ( b >= 0 )
+        {
+            ConvertConst( b, type );
+        }
+
+        if ( const_a && const_b )
+        {
+            return FoldReal( code, a, b, type );
+        }
+    }
+
+    ExprNode node;
+    node.m_Code = code;
+    node.m_Index = type;
+    node.m_Type = type;
+    node.m_Val = 0.0;
+    node.m_IntVal = 0;
+    node.m_A = a;
+    node.m_B = b;
+    m_Nodes.push_back( node );
+    return ( int )m_Nodes.size() - 1;
+}
+
+//==== Implicit Conversion Of Constant ====//
+void AdvLinkExpr::ConvertConst( int n, int type )
+{
+    ExprNode & node = m_Nodes[n];
+    if ( node.m_Code != OP_CONST || node.m_Type == type )
+    {
+        return;
+    }
+
+    if ( node.m_Type == T_INT )
+    {
+        node.m_Val = ( double )node.m_IntVal;
+    }
+
+    if ( type == T_FLOAT )
+    {
+        node.m_Val = ( float )node.m_Val;
+    }
+    node.m_Type = type;
+}
+
+//==== Floating Point Arithmetic On Constants ====//
+int AdvLinkExpr::FoldReal( int code, int a, int b, int type )
+{
+    double va = m_Nodes[a].m_Val;
+    double vb = ( b >= 0 ) ? m_Nodes[b].m_Val : 0.0;
+    double val = 0.0;
+
+    if ( code == OP_DIV && vb == 0.0 )
+    {
+        return -1;
+    }
+
+    if ( type == T_FLOAT )
+    {
+        float fa = ( float )va;
+        float fb = ( float )vb;
+        switch ( code )
+        {
+        case OP_NEG:    val = -fa;      break;
+        case OP_ADD:    val = fa + fb;  break;
+        case OP_SUB:    val = fa - fb;  break;
+        case OP_MUL:    val = fa * fb;  break;
+        case OP_DIV:    val = fa / fb;  break;
+        default:
+            return -1;
+        }
+    }
+    else
+    {
+        switch ( code )
+        {
+        case OP_NEG:    val = -va;      break;
+        case OP_ADD:    val = va + vb;  break;
+        case OP_SUB:    val = va - vb;  break;
+        case OP_MUL:    val = va * vb;  break;
+        case OP_DIV:    val = va / vb;  break;
+        default:
+            return -1;
+        }
+    }
+
+    ExprNode node;
+    node.m_Code = OP_CONST;
+    node.m_Index = -1;
+    node.m_Type = type;
+    node.m_Val = val;
+    node.m_IntVal = 0;
+    node.m_A = -1;
+    node.m_B = -1;
+    m_Nodes.push_back( node );
+    return ( int )m_Nodes.size() - 1;
+}
+
+//==== Integer Arithmetic On Constants, Anything Outside 32 Bits Is Left To The Script ====//
+int AdvLinkExpr::FoldInt( int code, int a, int b )
+{
+    long long ia = m_Nodes[a].m_IntVal;
+    long long ib = ( b >= 0 ) ? m_Nodes[b].m_IntVal : 0;
+    long long val = 0;
+
+    switch ( code )
+    {
+    case OP_NEG:    val = -ia;      break;
+    case OP_ADD:    val = ia + ib;  break;
+    case OP_SUB:    val = ia - ib;  break;
+    case OP_MUL:    val = ia * ib;  break;
+    case OP_DIV:
+        if ( ib == 0 )
+        {
+            return -1;
+        }
+        val = ia / ib;
+        break;
+    default:
+        return -1;
+    }
+
+    if ( val > INT_MAX || val < INT_MIN )
+    {
+        return -1;
+    }
+
+    ExprNode node;
+    node.m_Code = OP_CONST;
+    node.m_Index = -1;
+    node.m_Type = T_INT;
+    node.m_Val = 0.0;
+    node.m_IntVal = val;
+    node.m_A = -1;
+    node.m_B = -1;
+    m_Nodes.push_back( node );
+    return ( int )m_Nodes.size() - 1;
+}
+
+//==== Emit Node Tree As Stack Ops ====//
+void AdvLinkExpr::Emit( int n )
+{
+    const ExprNode node = m_Nodes[n];
+
+    if ( node.m_A >= 0 )
+    {
+        Emit( node.m_A );
+    }
+    if ( node.m_B >= 0 )
+    {
+        Emit( node.m_B );
+    }
+
+    ExprOp op;
+    op.m_Code = node.m_Code;
+    op.m_Index = node.m_Index;
+    op.m_Val = ( node.m_Type == T_INT ) ? ( double )node.m_IntVal : node.m_Val;
+    m_Ops.push_back( op );
+}
+
+//==== Find Var Slot ====//
+int AdvLinkExpr::FindVar( const string & name )
+{
+    for ( int i = 0 ; i < ( int )m_VarNames.size() ; i++ )
+    {
+        if ( m_VarNames[i] == name )
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//==== Find Math Function Registered With The Script Engine ====//
+int AdvLinkExpr::FindFunction( const string & name, int & num_args )
+{
+    static const char* names[] = { "cos", "sin", "tan", "acos", "asin", "atan", "atan2", "cosh", "sinh", "tanh",
+                                   "log", "log10", "pow", "sqrt", "ceil", "abs", "floor", "fraction",
+                                   "Min", "Max", "Rad2Deg", "Deg2Rad"
+                                 };
+
+    for ( int i = 0 ; i <= FN_DEG2RAD ; i++ )
+    {
+        if ( name == names[i] )
+        {
+            num_args = ( i == FN_ATAN2 || i == FN_POW || i == FN_MIN || i == FN_MAX ) ? 2 : 1;
+            return i;
+        }
+    }
+    num_args = 0;
+    return -1;
+}
+
+//==== Scan Real Number The Way The Script Tokenizer Does, So Constants Match Bit For Bit ====//
+double AdvLinkExpr::ScanDouble( const char* str, size_t & num_scanned )
+{
+    double value = 0;
+    double fraction = 0.1;
+    int exponent = 0;
+    bool negative_exponent = false;
+    int c = 0;
+
+    while ( str[c] >= '0' && str[c] <= '9' )
+    {
+        value = value * 10 + double( str[c] - '0' );
+        c++;
+    }
+
+    if ( str[c] == '.' )
+    {
+        c++;
+        while ( str[c] >= '0' && str[c] <= '9' )
+        {
+            value += fraction * double( str[c] - '0' );
+            c++;
+            fraction *= 0.1;
+        }
+    }
+
+    if ( str[c] == 'e' || str[c] == 'E' )
+    {
+        c++;
+        if ( str[c] == '-' )
+        {
+            negative_exponent = true;
+            c++;
+        }
+        else if ( str[c] == '+' )
+        {
+            c++;
+        }
+        while ( str[c] >= '0' && str[c] <= '9' )
+        {
+            exponent = exponent * 10 + int( str[c] - '0' );
+            c++;
+        }
+    }
+
+    if ( exponent )
+    {
+        if ( negative_exponent )
+        {
+            exponent = -exponent;
+        }
+        value *= pow( 10.0, exponent );
+    }
+
+    num_scanned = c;
+    return value;
+}
@@ -0,0 +1,116 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// AdvLinkExpr.h: Compiled form of advanced link scripts that are plain arithmetic
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_ADVLINKEXPR__INCLUDED_)
+#define VSP_ADVLINKEXPR__INCLUDED_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+//==== Advanced Link Expression ====//
+// Straight line script code made of assignments such as "Span = 0.5*Root + 3;" and
+// "double t = Root*Root;", using + - * / ( ), numbers, the link variables and the
+// math functions registered with the script engine.  Anything else is not compiled
+// and the link runs its AngelScript module as before.
+//
+// Evaluation follows the generated script: inputs are loaded, the statements run in
+// order, and output values persist from one evaluation to the next like the script's
+// global variables, starting at -1.0e15 (not set).  Dividing by zero stops evaluation
+// where the script engine would raise its exception, keeping what was assigned so far.
+class AdvLinkExpr
+{
+public:
+    AdvLinkExpr();
+
+    bool Compile( const string & code, const vector< string > & input_names, const vector< string > & output_names );
+    void Clear();
+    bool IsCompiled() const                                         { return m_Compiled; }
+
+    const vector< string > & GetInputNames() const                 { return m_InputNames; }
+    const vector< string > & GetOutputNames() const                { return m_OutputNames; }
+
+    bool Evaluate( const vector< double > & input_vals, vector< double > & output_vals );
+
+protected:
+
+    enum { OP_CONST, OP_VAR, OP_NEG, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_CALL1, OP_CALL2, OP_STORE };
+
+    enum { FN_COS, FN_SIN, FN_TAN, FN_ACOS, FN_ASIN, FN_ATAN, FN_ATAN2, FN_COSH, FN_SINH, FN_TANH,
+           FN_LOG, FN_LOG10, FN_POW, FN_SQRT, FN_CEIL, FN_ABS, FN_FLOOR, FN_FRACTION,
+           FN_MIN, FN_MAX, FN_RAD2DEG, FN_DEG2RAD
+         };
+
+    // Script value types, integers only come from literals and are always constant
+    enum { T_INT, T_FLOAT, T_DOUBLE };
+
+    struct ExprOp
+    {
+        int m_Code;
+        int m_Index;                    // Var slot, function, or value type of arithmetic
+        double m_Val;
+    };
+
+    struct ExprNode
+    {
+        int m_Code;
+        int m_Index;
+        int m_Type;
+        double m_Val;
+        long long m_IntVal;
+        int m_A;
+        int m_B;
+    };
+
+    enum { TOK_NUM, TOK_INT, TOK_NAME, TOK_CHAR, TOK_END };
+
+    struct ExprToken
+    {
+        int m_Type;
+        string m_Text;
+        double m_Val;
+        long long m_IntVal;
+    };
+
+    bool Tokenize( const string & code );
+    bool ParseStatement();
+    int ParseSum();
+    int ParseProduct();
+    int ParseUnary();
+    int ParsePrimary();
+    int AddNode( int code, int a, int b );
+    int FoldInt( int code, int a, int b );
+    int FoldReal( int code, int a, int b, int type );
+    void ConvertConst( int node, int type );
+    void Emit( int node );
+    int FindVar( const string & name );
+    static int FindFunction( const string & name, int & num_args );
+    static double ScanDouble( const char* str, size_t & num_scanned );
+
+    bool IsChar( char c );
+
+    bool m_Compiled;
+
+    vector< string > m_InputNames;
+    vector< string > m_OutputNames;
+    vector< string > m_VarNames;        // Inputs, outputs then locals
+    vector< double > m_VarVals;
+
+    vector< ExprOp > m_Ops;
+    vector< double > m_Stack;
+
+    //==== Compile Work Space ====//
+    vector< ExprToken > m_Tokens;
+    int m_Pos;
+    vector< ExprNode > m_Nodes;
+};
+
+#endif // !defined(VSP_ADVLINKEXPR__INCLUDED_)
@@ -18,7 +18,6 @@ AdvLinkMgrSingleton::AdvLinkMgrSingleton()
 {
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
-
 }
 
 void AdvLinkMgrSingleton::Init()
@@ -36,6 +35,7 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_InputParmLinkMap.clear();
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -96,6 +96,7 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
 
     vector_remove_val( m_LinkVec, link_ptr );
     delete link_ptr;
+    RebuildInputParmLinkMap();
 }
 
 void AdvLinkMgrSingleton::DelAllLinks( )
@@ -108,6 +109,7 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+    m_InputParmLinkMap.clear();
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -185,21 +187,34 @@ double AdvLinkMgrSingleton::GetVar( const string & var_name )
     return m_ActiveLink->GetVar( var_name );
 }
 
-bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
+//==== Index Links By Input Parm When Links Or Their Inputs Change ====//
+void AdvLinkMgrSingleton::RebuildInputParmLinkMap()
 {
+    m_InputParmLinkMap.clear();
     for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetInputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        vector< VarDef > def_vec = m_LinkVec[i]->GetInputVars();
+        for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
+        {
+            vector< AdvLink* > & link_vec = m_InputParmLinkMap[ def_vec[j].m_ParmID ];
+            if ( link_vec.empty() || link_vec.back() != m_LinkVec[i] )
+            {
+                link_vec.push_back( m_LinkVec[i] );
+            }
+        }
+    }
+}
+
+bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
+{
+    if ( m_InputParmLinkMap.find( pid ) == m_InputParmLinkMap.end() )
+    {
+        return false;
+    }
+
+    if ( ParmMgr.FindParm( pid ) )
+    {
+        return true;
     }
     return false;
 }
@@ -233,10 +248,17 @@ void AdvLinkMgrSingleton::UpdateLinks( const string& pid  )
         return;
     }
 
-    //==== Check All Links And Update If Needed ====//
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    //==== Update The Links With This Input ====//
+    unordered_map< string, vector< AdvLink* > >::const_iterator it = m_InputParmLinkMap.find( pid );
+    if ( it == m_InputParmLinkMap.end() )
+    {
+        return;
+    }
+
+    vector< AdvLink* > link_vec = it->second;
+    for ( int i = 0 ; i < (int)link_vec.size() ; i++ )
     {
-        m_LinkVec[i]->UpdateLink( pid );
+        link_vec[i]->UpdateLink( pid );
     }
 }
 
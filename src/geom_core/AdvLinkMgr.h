@@ -13,9 +13,11 @@
 
 #include "AdvLink.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Adv Link Manager ====//
@@ -57,6 +59,8 @@ public:
 
     bool DuplicateLinkName( const string & name );
 
+    void InputVarsChanged()                                             { RebuildInputParmLinkMap(); }
+
     xmlNodePtr EncodeXml( xmlNodePtr & node );
     xmlNodePtr DecodeXml( xmlNodePtr & node );
 
@@ -72,6 +76,9 @@ private:
     AdvLink* m_ActiveLink;
     vector< AdvLink* > m_LinkVec;
 
+    unordered_map< string, vector< AdvLink* > > m_InputParmLinkMap;    // Input Parm ID->Links, In m_LinkVec Order
+    void RebuildInputParmLinkMap();
+
 };
 
 #define AdvLinkMgr AdvLinkMgrSingleton::getInstance()
@@ -15,6 +15,7 @@
 #include "SubSurfaceMgr.h"
 #include "HingeGeom.h"
 #include "VspUtil.h"
+#include "ParallelUtil.h"
 using namespace vsp;
 
 #include <float.h>
@@ -127,7 +128,7 @@ GeomBase::~GeomBase()
 // Tess - tessellation resolution (requires re-tessellation)
 // Highlight - active section highlighting
 //
-// This works in conjunction with strategic caching.  m_MainSurfVec, m_SurfVec, m_MainTessVec, m_TessVec are all
+// This works in conjunction with strategic caching.  m_MainSurfVec, m_SurfVec, m_MainTessVec, m_TessInstVec are all
 // cached to allow minimal updates according to the classified dirty flags.
 //
 // In the future, additional groups may be added.  In particular, a group that only updates the OpenGL visualization,
@@ -239,7 +240,7 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
         SetDirtyFlags( parm_ptr );
     }
 
-    if ( type == Parm::SET )
+    if ( type == Parm::SET || ParmMgr.IsBatchOpen() )
     {
         m_LateUpdateFlag = true;
         return;
@@ -1637,6 +1638,7 @@ void Geom::ApplySymm( vector<T> const &source, vector<T> &dest )
 void Geom::UpdateChildren( bool fullupdate )
 {
     vector< string > updated_child_vec;
+    vector< Geom* > child_vec;
     for ( int i = 0 ; i < (int)m_ChildIDVec.size() ; i++ )
     {
         Geom* child = m_Vehicle->FindGeom( m_ChildIDVec[i] );
@@ -1678,13 +1680,20 @@ void Geom::UpdateChildren( bool fullupdate )
             // Ignore the abs location values and only use rel values for children so a child
             // with abs button selected stays attached to parent if the parent moves
             child->m_ignoreAbsFlag = true;
-            child->Update( fullupdate );
-            child->m_ignoreAbsFlag = false;
+            child_vec.push_back( child );
 
             updated_child_vec.push_back( m_ChildIDVec[i] );
         }
     }
 
+    // Siblings only depend on this geom, so the vehicle may update them concurrently
+    m_Vehicle->UpdateGeoms( child_vec, fullupdate );
+
+    for ( int i = 0 ; i < (int)child_vec.size() ; i++ )
+    {
+        child_vec[i]->m_ignoreAbsFlag = false;
+    }
+
     // Update Children Vec
     m_ChildIDVec = updated_child_vec;
 }
@@ -2282,13 +2291,14 @@ void Geom::UpdateDrawObj()
     // Pre-calculate and allocate for number of feature line segments.
     // Identified by profiling as a substantial cost.
     int numfealineseg = 0;
-    for ( int i = 0 ; i < GetNumTotalSurfs() ; i++ )
+    for ( int i = 0 ; i < ( int )m_TessInstVec.size() ; i++ )
     {
-        int nfl = m_FeatureTessVec[i].m_ptline.size();
+        const SimpleFeatureTess & ftess = m_MainFeatureTessVec[ m_TessInstVec[i].m_MainIndx ];
+        int nfl = ftess.m_ptline.size();
 
         for( int j = 0; j < nfl; j++ )
         {
-            int n = m_FeatureTessVec[i].m_ptline[j].size() - 1;
+            int n = ftess.m_ptline[j].size() - 1;
 
             numfealineseg += 2 * n;
         }
@@ -2296,13 +2306,18 @@ void Geom::UpdateDrawObj()
     m_FeatureDrawObj_vec[0].m_PntVec.reserve( numfealineseg );
 
     int nsurf = GetNumTotalSurfs();
-    if ( m_TessVec.size() == nsurf && m_SurfVec.size() == nsurf && m_FeatureTessVec.size() == nsurf )
+    if ( m_TessInstVec.size() == nsurf && m_SurfVec.size() == nsurf )
     {
         //==== Tesselate Surface ====//
+        // Symmetric copies are transformed from the main tessellation as they are packed
         for ( int i = 0 ; i < nsurf ; i++ )
         {
+            const TessInstance & inst = m_TessInstVec[i];
+            const SimpleTess & tess = m_MainTessVec[ inst.m_MainIndx ];
+            const SimpleFeatureTess & ftess = m_MainFeatureTessVec[ inst.m_MainIndx ];
+
             int iflip = 0;
-            if ( m_TessVec[i].GetFlipNormal() )
+            if ( inst.m_FlipNormal )
             {
                 iflip = 1;
             }
@@ -2312,28 +2327,24 @@ void Geom::UpdateDrawObj()
                 iflip += 2;
             }
 
-            m_WireShadeDrawObj_vec[iflip].m_PntMesh.insert( m_WireShadeDrawObj_vec[iflip].m_PntMesh.end(),
-                    m_TessVec[i].m_pnts.begin(), m_TessVec[i].m_pnts.end() );
-            m_WireShadeDrawObj_vec[iflip].m_NormMesh.insert( m_WireShadeDrawObj_vec[iflip].m_NormMesh.end(),
-                    m_TessVec[i].m_norms.begin(), m_TessVec[i].m_norms.end() );
+            tess.AppendPnts( m_WireShadeDrawObj_vec[iflip].m_PntMesh, inst.m_Mat );
+            tess.AppendNorms( m_WireShadeDrawObj_vec[iflip].m_NormMesh, inst.m_Mat );
 
-            m_WireShadeDrawObj_vec[iflip].m_uTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_uTexMesh.end(),
-                    m_TessVec[i].m_utex.begin(), m_TessVec[i].m_utex.end() );
-            m_WireShadeDrawObj_vec[iflip].m_vTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_vTexMesh.end(),
-                    m_TessVec[i].m_vtex.begin(), m_TessVec[i].m_vtex.end() );
+            tess.AppendUTex( m_WireShadeDrawObj_vec[iflip].m_uTexMesh );
+            tess.AppendVTex( m_WireShadeDrawObj_vec[iflip].m_vTexMesh );
 
             if( m_GuiDraw.GetDispFeatureFlag() )
             {
-                int nfl = m_FeatureTessVec[i].m_ptline.size();
+                int nfl = ftess.m_ptline.size();
 
                 for( int j = 0; j < nfl; j++ )
                 {
-                    int n = m_FeatureTessVec[i].m_ptline[j].size() - 1;
+                    int n = ftess.m_ptline[j].size() - 1;
 
                     for ( int k = 0; k < n; k++ )
                     {
-                        m_FeatureDrawObj_vec[0].m_PntVec.push_back( m_FeatureTessVec[i].m_ptline[j][ k ] );
-                        m_FeatureDrawObj_vec[0].m_PntVec.push_back( m_FeatureTessVec[i].m_ptline[j][ k + 1 ] );
+                        m_FeatureDrawObj_vec[0].m_PntVec.push_back( inst.m_Mat.xform( ftess.m_ptline[j][ k ] ) );
+                        m_FeatureDrawObj_vec[0].m_PntVec.push_back( inst.m_Mat.xform( ftess.m_ptline[j][ k + 1 ] ) );
                     }
                 }
 
@@ -2691,10 +2702,27 @@ void Geom::UpdateMainTessVec( bool firstonly )
 
     m_MainTessVec.resize( nmain );
     m_MainFeatureTessVec.resize( nmain );
+    m_MainTessKeyVec.resize( nmain, 0 );
 
-    for ( int i = 0 ; i < nmain ; i++ )
+    // Main surfaces are independent, each task only touches surface i and its tessellations
+    ParallelFor( nmain, [ & ]( int i )
     {
-        UpdateSplitTesselate( m_MainSurfVec, i, m_MainTessVec[i].m_pnts, m_MainTessVec[i].m_norms );
+        //==== Keep Previous Tessellation If Surface And Tess Settings Are Unchanged ====//
+        m_MainSurfVec[i].SetReuseTessKey( m_MainTessKeyVec[i] );
+
+        vector< vector< vector< vec3d > > > pnts, norms;
+        UpdateSplitTesselate( m_MainSurfVec, i, pnts, norms );
+
+        std::size_t key = m_MainSurfVec[i].GetLastTessKey();
+        bool reuse = ( key != 0 && key == m_MainTessKeyVec[i] );
+        m_MainTessKeyVec[i] = key;
+
+        if ( reuse )
+        {
+            return;
+        }
+
+        m_MainTessVec[i].SetPatches( pnts, norms );
 
         bool fn = m_MainSurfVec[i].GetFlipNormal();
         m_MainTessVec[i].m_FlipNormal = fn;
@@ -2719,14 +2747,36 @@ void Geom::UpdateMainTessVec( bool firstonly )
         {
             m_MainSurfVec[i].TessWFeatureLine( j, m_MainFeatureTessVec[i].m_ptline[j+nu], tol );
         }
-    }
+    } );
 }
 
 // Propagate symmetry and position to tessellation and feature line tess.
+// Copies are not stored, each surface refers to its main tessellation with the
+// transformation and normal flip that ApplySymm would have applied to a copy.
 void Geom::UpdateTessVec()
 {
-    ApplySymm( m_MainTessVec, m_TessVec );
-    ApplySymm( m_MainFeatureTessVec, m_FeatureTessVec );
+    int num_main = GetNumMainSurfs();
+    unsigned int num_surf = GetNumTotalSurfs();
+    m_TessInstVec.clear();
+
+    if ( m_MainTessVec.size() != num_main || m_MainFeatureTessVec.size() != num_main ||
+         m_SurfIndxVec.size() != num_surf || m_TransMatVec.size() != num_surf )
+    {
+        return;
+    }
+
+    m_TessInstVec.resize( num_surf );
+    for ( int i = 0 ; i < ( int )num_surf ; i++ )
+    {
+        int imain = m_SurfIndxVec[i];
+
+        // Planar reflections toggle the flip of the main surface
+        bool reflected = ( m_FlipNormalVec[i] != GetMainFlipNormal( imain ) );
+
+        m_TessInstVec[i].m_MainIndx = imain;
+        m_TessInstVec[i].m_Mat = m_TransMatVec[i];
+        m_TessInstVec[i].m_FlipNormal = ( m_MainTessVec[imain].GetFlipNormal() != reflected );
+    }
 }
 
 void Geom::UpdateMainDegenGeomPreview()
@@ -3597,28 +3647,35 @@ void Geom::CreateMainDegenGeom( vector<DegenGeom> &dgs, bool preview )
 
 void Geom::CreateDegenGeom( vector <VspSurf> &surf_vec, const int &nsurf, vector<DegenGeom> &dgs, bool preview )
 {
-    vector< vector< vec3d > > pnts;
-    vector< vector< vec3d > > nrms;
-    vector< vector< vec3d > > uwpnts;
+    vector< vector< vector< vec3d > > > pnts_vec( nsurf );
+    vector< vector< vector< vec3d > > > nrms_vec( nsurf );
+    vector< vector< vector< vec3d > > > uwpnts_vec( nsurf );
 
-    for ( int i = 0 ; i < nsurf ; i++ )
+    //==== Tesselate Surfaces Concurrently ====//
+    ParallelFor( nsurf, [ & ]( int i )
     {
-        bool urootcap = false;
-
         surf_vec[i].ResetUSkip();
         if ( m_CapUMinSuccess[ m_SurfIndxVec[i] ] )
         {
             surf_vec[i].SetUSkipFirst( true );
-            urootcap = true;
         }
         if ( m_CapUMaxSuccess[ m_SurfIndxVec[i] ] )
         {
             surf_vec[i].SetUSkipLast( true );
         }
 
-        //==== Tesselate Surface ====//
-        UpdateTesselate( surf_vec, i, pnts, nrms, uwpnts, true );
+        UpdateTesselate( surf_vec, i, pnts_vec[i], nrms_vec[i], uwpnts_vec[i], true );
         surf_vec[i].ResetUSkip();
+    } );
+
+    //==== Build Degen Geoms In Surface Order ====//
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        bool urootcap = m_CapUMinSuccess[ m_SurfIndxVec[i] ];
+
+        const vector< vector< vec3d > > & pnts = pnts_vec[i];
+        const vector< vector< vec3d > > & nrms = nrms_vec[i];
+        const vector< vector< vec3d > > & uwpnts = uwpnts_vec[i];
 
         int surftype = DegenGeom::BODY_TYPE;
         if( surf_vec[i].GetSurfType() == vsp::WING_SURF || surf_vec[i].GetSurfType() == vsp::PROP_SURF )
@@ -4668,8 +4725,16 @@ void Geom::AddLinkableParms( vector< string > & linkable_parm_vec, const string
 
 void Geom::ChangeID( string id )
 {
+    string old_id = m_ID;
+
     ParmContainer::ChangeID( id );
 
+    // Keep the vehicle's ID map in step
+    if ( m_Vehicle )
+    {
+        m_Vehicle->ChangeGeomID( old_id, this );
+    }
+
     for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i ++ )
     {
         m_SubSurfVec[i]->SetParentContainer( GetID() );
@@ -5008,6 +5073,27 @@ bool Geom::HasWingTypeSurfs()
     return false;
 }
 
+//==== Can This Geom Update Alongside Geoms That Are Not Its Ancestors Or Descendants ====//
+bool Geom::IsParallelUpdateSafe()
+{
+    // Custom geoms run their update in the shared script engine, and mesh, point
+    // cloud and human geoms have not been checked for shared state.
+    int type = GetType().m_Type;
+    if ( type == CUSTOM_GEOM_TYPE || type == MESH_GEOM_TYPE ||
+         type == PT_CLOUD_GEOM_TYPE || type == HUMAN_GEOM_TYPE )
+    {
+        return false;
+    }
+
+    // FEA structures update through the structure manager
+    if ( m_FeaStructVec.size() > 0 )
+    {
+        return false;
+    }
+
+    return true;
+}
+
 void Geom::AppendWakeData( vector < piecewise_curve_type >& curve_vec, vector < double > & wake_scale_vec, vector < double > & wake_angle_vec )
 {
     if( m_WakeActiveFlag() )
@@ -651,6 +651,9 @@ public:
     virtual void AppendWakeData( vector < piecewise_curve_type >& curve_vec, vector < double >& wake_scale_vec, vector < double >& wake_angle_vec );
     virtual bool HasWingTypeSurfs();
 
+    //==== Can This Geom Update Alongside Geoms That Are Not Its Ancestors Or Descendants ====//
+    virtual bool IsParallelUpdateSafe();
+
     //=== End Cap Parms ===//
     IntParm m_CapUMinOption;
     LimIntParm m_CapUMinTess;
@@ -753,9 +756,9 @@ protected:
     vector<DrawObj> m_DegenSubSurfDrawObj_vec;
 
     vector <SimpleTess> m_MainTessVec;
-    vector <SimpleTess> m_TessVec;
+    vector < std::size_t > m_MainTessKeyVec;      // VspSurf tessellation key m_MainTessVec[i] was made with, 0 if none
     vector <SimpleFeatureTess> m_MainFeatureTessVec;
-    vector <SimpleFeatureTess> m_FeatureTessVec;
+    vector <TessInstance> m_TessInstVec;          // Placement of m_MainTessVec and m_MainFeatureTessVec for each surface
 
     vector< DegenGeom > m_MainDegenGeomPreviewVec;
     vector< DegenGeom > m_DegenGeomPreviewVec;
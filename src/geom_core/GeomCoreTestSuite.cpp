@@ -7,7 +7,17 @@
 
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
+#include "AdvLinkExpr.h"
+#include "AdvLink.h"
+#include "AdvLinkMgr.h"
+#include "ScriptMgr.h"
+#include "LinkMgr.h"
+#include "ParmMgr.h"
+#include "ParallelUtil.h"
+#include "SubSurfaceMgr.h"
 #include <cfloat>  //For DBL_EPSILON
+#include <chrono>
+#include <random>
 
 //==== Test GeomXForm ====//
 void GeomCoreTestSuite::GeomXFormTest()
@@ -52,6 +62,7 @@ void GeomCoreTestSuite::VehicleTest()
 {
 
     Vehicle veh;
+    veh.Init();
     GeomType type;
     type.m_Name = "POD";
 
@@ -72,6 +83,27 @@ void GeomCoreTestSuite::VehicleTest()
     veh.AddActiveGeom( id3 );
     string id5 = veh.AddGeom( type );
 
+    //==== ID Map Follows Adds, Deletes And Cut/Paste ====//
+    TEST_ASSERT( veh.CheckGeomIDMap() );
+    TEST_ASSERT( veh.FindGeom( id3 ) && veh.FindGeom( id3 )->GetID() == id3 );
+
+    vector< string > del_vec;
+    del_vec.push_back( id4 );
+    veh.DeleteGeomVec( del_vec );
+    TEST_ASSERT( veh.FindGeom( id4 ) == NULL );
+    TEST_ASSERT( veh.CheckGeomIDMap() );
+
+    veh.SetActiveGeom( id3 );
+    veh.CutActiveGeomVec();
+    TEST_ASSERT( veh.CheckGeomIDMap() );
+
+    vector< string > paste_vec = veh.PasteClipboard();
+    TEST_ASSERT( veh.CheckGeomIDMap() );
+    for ( int i = 0 ; i < ( int )paste_vec.size() ; i++ )
+    {
+        TEST_ASSERT( veh.FindGeom( paste_vec[i] ) && veh.FindGeom( paste_vec[i] )->GetID() == paste_vec[i] );
+    }
+
     //vector< string > geom_vec = veh.GetGeomVec();
     //TEST_ASSERT( geom_vec[0] == id0 );
     //TEST_ASSERT( geom_vec[1] == id1 );
@@ -193,6 +225,7 @@ void GeomCoreTestSuite::XmlTest()
 void GeomCoreTestSuite::MeshIOTest()
 {
     Vehicle veh;
+    veh.Init();
     GeomType type;
     string out_file;
     type.m_Type = POD_GEOM_TYPE;
@@ -240,6 +273,598 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Test Compiled Adv Link Expressions ====//
+void GeomCoreTestSuite::AdvLinkExprTest()
+{
+    vector< string > in_names;
+    in_names.push_back( "Root" );
+    in_names.push_back( "Tip" );
+    vector< string > out_names;
+    out_names.push_back( "Span" );
+    out_names.push_back( "Area" );
+
+    AdvLinkExpr expr;
+    TEST_ASSERT( expr.Compile( "double t = 0.5*(Root + Tip); // mean\n Span = 7/2*t - -1; Area = Min( Root, Tip )*Span;",
+                               in_names, out_names ) );
+
+    vector< double > in_vals;
+    in_vals.push_back( 2.0 );
+    in_vals.push_back( 4.0 );
+    vector< double > out_vals;
+    expr.Evaluate( in_vals, out_vals );
+    TEST_ASSERT( out_vals.size() == 2 );
+    TEST_ASSERT_DELTA( 10.0, out_vals[0], 1.0e-12 );        // Integer division as in script
+    TEST_ASSERT_DELTA( 20.0, out_vals[1], 1.0e-12 );
+
+    //==== Math Functions Are Single Precision ====//
+    TEST_ASSERT( expr.Compile( "Span = sin( Root );", in_names, out_names ) );
+    expr.Evaluate( in_vals, out_vals );
+    TEST_ASSERT( out_vals[0] == ( double )sinf( 2.0f ) );
+    TEST_ASSERT( out_vals[1] == -1.0e15 );                  // Never set
+
+    //==== Divide By Zero Throws In The Script ====//
+    TEST_ASSERT( expr.Compile( "Span = 1; Area = Root / ( Tip - Tip );", in_names, out_names ) );
+    TEST_ASSERT( !expr.Evaluate( in_vals, out_vals ) );
+
+    //==== Anything Else Is Left To The Script Engine ====//
+    TEST_ASSERT( !expr.Compile( "if ( Root > 1 ) { Span = 1; }", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "Span += 1;", in_names, out_names ) );
+    TEST_ASSERT( !expr.Compile( "Span = GetVar( \"Root\" );", in_names, out_names ) );
+    TEST_ASSERT( !expr.IsCompiled() );
+}
+
+//==== Random Code From The Subset AdvLinkExpr Compiles ====//
+static string RandomLinkExpr( std::mt19937 & gen, const vector< string > & var_vec, int depth )
+{
+    static const char* fn1[] = { "cos", "sin", "tan", "acos", "asin", "atan", "cosh", "sinh", "tanh",
+                                 "log", "log10", "sqrt", "ceil", "abs", "floor", "fraction", "Rad2Deg", "Deg2Rad"
+                               };
+    static const char* fn2[] = { "atan2", "pow", "Min", "Max" };
+    static const char* ops[] = { " + ", " - ", " * ", " / " };
+
+    std::uniform_int_distribution< int > pick( 0, 99 );
+    char str[64];
+
+    int choice = pick( gen );
+    if ( depth == 0 || choice < 30 )
+    {
+        choice = pick( gen );
+        if ( choice < 45 )
+        {
+            return var_vec[ pick( gen ) % var_vec.size() ];
+        }
+        else if ( choice < 70 )
+        {
+            snprintf( str, sizeof( str ), "%d", 1 + pick( gen ) % 12 );       // Integer literal
+        }
+        else
+        {
+            snprintf( str, sizeof( str ), "%d.%d", pick( gen ) % 5, pick( gen ) );
+        }
+        return string( str );
+    }
+    else if ( choice < 40 )
+    {
+        return "-" + RandomLinkExpr( gen, var_vec, depth - 1 );
+    }
+    else if ( choice < 55 )
+    {
+        return "( " + RandomLinkExpr( gen, var_vec, depth - 1 ) + " )";
+    }
+    else if ( choice < 68 )
+    {
+        return string( fn1[ pick( gen ) % ( sizeof( fn1 ) / sizeof( fn1[0] ) ) ] ) + "( " + RandomLinkExpr( gen, var_vec, depth - 1 ) + " )";
+    }
+    else if ( choice < 75 )
+    {
+        return string( fn2[ pick( gen ) % ( sizeof( fn2 ) / sizeof( fn2[0] ) ) ] ) + "( " + RandomLinkExpr( gen, var_vec, depth - 1 ) + ", " +
+               RandomLinkExpr( gen, var_vec, depth - 1 ) + " )";
+    }
+    return RandomLinkExpr( gen, var_vec, depth - 1 ) + ops[ pick( gen ) % 4 ] + RandomLinkExpr( gen, var_vec, depth - 1 );
+}
+
+//==== What The Output Parm Holds After AdvLink::SetVar, Starting From unset_val ====//
+static double LinkOutputParmVal( double val, double unset_val )
+{
+    if ( !( val > -1.0e15 ) || std::abs( val - unset_val ) < DBL_EPSILON )
+    {
+        return unset_val;
+    }
+    return std::min( val, DBL_MAX );
+}
+
+//==== Compiled Expressions Match The Script Engine Exactly ====//
+void GeomCoreTestSuite::AdvLinkScriptMatchTest()
+{
+    const char* in_names[] = { "Root", "Tip" };
+    const char* out_names[] = { "Span", "Area" };
+    const double unset_val = 1234.5678;
+
+    Parm in_parms[2];
+    Parm out_parms[2];
+    AdvLink link;
+    link.SetName( "ExprMatchTest" );
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        in_parms[i].Init( in_names[i], "Test", NULL, 0.0, -DBL_MAX, DBL_MAX );
+        out_parms[i].Init( out_names[i], "Test", NULL, unset_val, -DBL_MAX, DBL_MAX );
+
+        VarDef in_var;
+        in_var.m_VarName = in_names[i];
+        in_var.m_ParmID = in_parms[i].GetID();
+        link.AddVar( in_var, true );
+
+        VarDef out_var;
+        out_var.m_VarName = out_names[i];
+        out_var.m_ParmID = out_parms[i].GetID();
+        link.AddVar( out_var, false );
+    }
+
+    std::mt19937 gen( 1234 );
+    std::uniform_real_distribution< double > in_dist( -3.0, 3.0 );
+
+    int num_compiled = 0;
+    int num_match = 0;
+    for ( int trial = 0 ; trial < 500 ; trial++ )
+    {
+        //==== A Local Or Two, Then Both Outputs, Which May Read Earlier Values ====//
+        vector< string > var_vec( in_names, in_names + 2 );
+        var_vec.push_back( "Span" );
+
+        string code;
+        int num_local = trial % 3;
+        for ( int i = 0 ; i < num_local ; i++ )
+        {
+            string local = "t" + std::to_string( i );
+            code += "double " + local + " = " + RandomLinkExpr( gen, var_vec, 4 ) + ";\n";
+            var_vec.push_back( local );
+        }
+        code += "Span = " + RandomLinkExpr( gen, var_vec, 4 ) + ";\n";
+        code += "Area = " + RandomLinkExpr( gen, var_vec, 4 ) + ";\n";
+
+        AdvLinkExpr expr;
+        vector< string > in_vec( in_names, in_names + 2 );
+        vector< string > out_vec( out_names, out_names + 2 );
+        if ( !expr.Compile( code, in_vec, out_vec ) )
+        {
+            continue;
+        }
+        num_compiled++;
+
+        link.SetScriptCode( code );
+        TEST_ASSERT( link.BuildScript() );
+
+        //==== Same Inputs, Then The Module's UpdateLink() Against Evaluate ====//
+        vector< double > in_vals( 2 );
+        for ( int i = 0 ; i < 2 ; i++ )
+        {
+            in_vals[i] = in_dist( gen );
+            in_parms[i].Set( in_vals[i] );
+            out_parms[i].Set( unset_val );
+        }
+
+        AdvLinkMgr.SetActiveLink( &link );
+        ScriptMgr.ExecuteScript( "AdvLink_ExprMatchTest", "void UpdateLink()" );
+        AdvLinkMgr.SetActiveLink( NULL );
+
+        //==== Divide By Zero Stops Both Before The Outputs Are Set ====//
+        vector< double > out_vals;
+        bool finished = expr.Evaluate( in_vals, out_vals );
+
+        bool match = true;
+        for ( int i = 0 ; i < 2 ; i++ )
+        {
+            double expect_val = finished ? LinkOutputParmVal( out_vals[i], unset_val ) : unset_val;
+            if ( out_parms[i].Get() != expect_val )
+            {
+                match = false;
+                printf( "AdvLinkScriptMatchTest %s = %.17g script, %.17g compiled\n%s", out_names[i],
+                        out_parms[i].Get(), expect_val, code.c_str() );
+            }
+        }
+        TEST_ASSERT( match );
+        if ( match )
+        {
+            num_match++;
+        }
+    }
+
+    //==== Nearly Everything Generated Is In The Compiled Subset ====//
+    TEST_ASSERT( num_compiled > 400 );
+    TEST_ASSERT( num_match == num_compiled );
+
+    ScriptMgr.RemoveScript( "AdvLink_ExprMatchTest" );
+}
+
+//==== Compare And Time TBvh Against The TBndBox Octree ====//
+static double BvhTestTime()
+{
+    return std::chrono::duration< double >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+static int ClearISectEdges( TMesh* tm )
+{
+    int cnt = 0;
+    for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+    {
+        vector< TEdge* > & evec = tm->m_TVec[t]->m_ISectEdgeVec;
+        cnt += ( int )evec.size();
+        for ( int e = 0 ; e < ( int )evec.size() ; e++ )
+        {
+            delete evec[e]->m_N0;
+            delete evec[e]->m_N1;
+            delete evec[e];
+        }
+        evec.clear();
+    }
+    return cnt;
+}
+
+void GeomCoreTestSuite::TMeshBvhTest()
+{
+    Vehicle veh;
+    veh.Init();
+
+    GeomType types[3];
+    types[0] = GeomType( POD_GEOM_TYPE, "POD" );
+    types[1] = GeomType( FUSELAGE_GEOM_TYPE, "FUSELAGE" );
+    types[2] = GeomType( MS_WING_GEOM_TYPE, "WING" );
+
+    //==== Representative Models, Overlapping At The Origin ====//
+    vector< TMesh* > tmesh_vec;
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        Geom* geom = veh.FindGeom( veh.AddGeom( types[g] ) );
+        TEST_ASSERT( geom != NULL );
+        if ( !geom )
+        {
+            continue;
+        }
+
+        geom->m_TessU = 40;
+        geom->m_TessW = 41;
+        geom->Update();
+
+        vector< TMesh* > tmv = geom->CreateTMeshVec();
+        tmesh_vec.insert( tmesh_vec.end(), tmv.begin(), tmv.end() );
+    }
+
+    int nmesh = ( int )tmesh_vec.size();
+    vector< TBndBox* > oct_vec( nmesh );
+
+    double oct_build = 0.0, bvh_build = 0.0;
+    int ntri = 0;
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        double t0 = BvhTestTime();
+        oct_vec[m] = new TBndBox();
+        for ( int t = 0 ; t < ( int )tmesh_vec[m]->m_TVec.size() ; t++ )
+        {
+            oct_vec[m]->AddTri( tmesh_vec[m]->m_TVec[t] );
+        }
+        oct_vec[m]->SplitBox();
+        double t1 = BvhTestTime();
+        tmesh_vec[m]->LoadBndBox();
+        double t2 = BvhTestTime();
+
+        oct_build += t1 - t0;
+        bvh_build += t2 - t1;
+        ntri += ( int )tmesh_vec[m]->m_TVec.size();
+
+        TEST_ASSERT( tmesh_vec[m]->m_TBvh.m_Box == oct_vec[m]->m_Box );
+    }
+
+    //==== Pair Queries Give The Same Answers ====//
+    double oct_pair = 0.0, bvh_pair = 0.0;
+    for ( int a = 0 ; a < nmesh ; a++ )
+    {
+        for ( int b = a + 1 ; b < nmesh ; b++ )
+        {
+            double t0 = BvhTestTime();
+            bool oct_check = oct_vec[a]->CheckIntersect( oct_vec[b] );
+            double oct_dist = oct_vec[a]->MinDistance( oct_vec[b], 1.0e12 );
+            oct_vec[a]->Intersect( oct_vec[b] );
+            double t1 = BvhTestTime();
+            int oct_edges = ClearISectEdges( tmesh_vec[a] ) + ClearISectEdges( tmesh_vec[b] );
+
+            double t2 = BvhTestTime();
+            bool bvh_check = tmesh_vec[a]->CheckIntersect( tmesh_vec[b] );
+            double bvh_dist = tmesh_vec[a]->MinDistance( tmesh_vec[b], 1.0e12 );
+            tmesh_vec[a]->Intersect( tmesh_vec[b] );
+            double t3 = BvhTestTime();
+            int bvh_edges = ClearISectEdges( tmesh_vec[a] ) + ClearISectEdges( tmesh_vec[b] );
+
+            oct_pair += t1 - t0;
+            bvh_pair += t3 - t2;
+
+            TEST_ASSERT( oct_check == bvh_check );
+            TEST_ASSERT_DELTA( oct_dist, bvh_dist, 1.0e-12 );
+            TEST_ASSERT( oct_edges == bvh_edges );
+        }
+    }
+
+    //==== Rays From Every Tri Center Cross Every Other Mesh The Same Number Of Times ====//
+    double oct_ray = 0.0, bvh_ray = 0.0;
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+    for ( int a = 0 ; a < nmesh ; a++ )
+    {
+        for ( int t = 0 ; t < ( int )tmesh_vec[a]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[a]->m_TVec[t];
+            vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) / 3.0;
+
+            for ( int b = 0 ; b < nmesh ; b++ )
+            {
+                if ( b == a )
+                {
+                    continue;
+                }
+
+                vector< double > oct_hits, bvh_hits;
+                double t0 = BvhTestTime();
+                oct_vec[b]->RayCast( orig, dir, oct_hits );
+                double t1 = BvhTestTime();
+                tmesh_vec[b]->m_TBvh.RayCast( orig, dir, bvh_hits );
+                double t2 = BvhTestTime();
+
+                oct_ray += t1 - t0;
+                bvh_ray += t2 - t1;
+
+                TEST_ASSERT( oct_hits.size() == bvh_hits.size() );
+            }
+        }
+    }
+
+    //==== Packets Of Rays Match Single Rays Hit For Hit ====//
+    int num_packet_mism = 0;
+    for ( int a = 0 ; a < nmesh ; a++ )
+    {
+        vector< vec3d > orig_vec;
+        for ( int t = 0 ; t < ( int )tmesh_vec[a]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[a]->m_TVec[t];
+            orig_vec.push_back( ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) / 3.0 );
+        }
+
+        for ( int b = 0 ; b < nmesh ; b++ )
+        {
+            if ( b == a )
+            {
+                continue;
+            }
+
+            vector< vector< double > > packet_hits;
+            tmesh_vec[b]->m_TBvh.RayCastPacket( orig_vec, dir, packet_hits );
+
+            for ( int i = 0 ; i < ( int )orig_vec.size() ; i++ )
+            {
+                vector< double > bvh_hits;
+                tmesh_vec[b]->m_TBvh.RayCast( orig_vec[i], dir, bvh_hits );
+                if ( bvh_hits != packet_hits[i] )
+                {
+                    num_packet_mism++;
+                }
+            }
+        }
+    }
+    TEST_ASSERT( num_packet_mism == 0 );
+
+    printf( "TMesh BVH: %d meshes, %d tris\n", nmesh, ntri );
+    printf( "  build    octree %8.4f s  bvh %8.4f s\n", oct_build, bvh_build );
+    printf( "  pairs    octree %8.4f s  bvh %8.4f s\n", oct_pair, bvh_pair );
+    printf( "  raycast  octree %8.4f s  bvh %8.4f s\n", oct_ray, bvh_ray );
+
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        delete oct_vec[m];
+        delete tmesh_vec[m];
+    }
+}
+
+//==== Concurrent Geom Updates Match Serial Ones ====//
+//==== Make Sure There Are Workers To Share, Even On A Single Core Machine ====//
+static int AddTestWorkers()
+{
+    int num_added = 0;
+    if ( GetFreeWorkerThreads() < 3 )
+    {
+        num_added = 3 - GetFreeWorkerThreads();
+        ReleaseWorkerThreads( num_added );
+    }
+    return num_added;
+}
+
+static void SetPodsAndUpdate( Vehicle & veh, const vector< string > & id_vec, double scale, vector< BndBox > & bbox_vec )
+{
+    for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+    {
+        Geom* geom = veh.FindGeom( id_vec[i] );
+        ParmMgr.FindParm( geom->FindParm( "Length", "Design" ) )->Set( scale * ( i + 1 ) );
+        ParmMgr.FindParm( geom->FindParm( "Y_Rel_Location", "XForm" ) )->Set( scale * i );
+    }
+
+    veh.Update();
+
+    bbox_vec.clear();
+    for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+    {
+        bbox_vec.push_back( veh.FindGeom( id_vec[i] )->GetBndBox() );
+    }
+}
+
+void GeomCoreTestSuite::ParallelUpdateTest()
+{
+    Vehicle veh;
+    veh.Init();
+    GeomType type( POD_GEOM_TYPE, "POD" );
+
+    vector< string > id_vec;
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        id_vec.push_back( veh.AddGeom( type ) );
+    }
+
+    //==== First Pod's Length Drives Second Pod's X Location, Those Two Update Serially ====//
+    string len_id = veh.FindGeom( id_vec[0] )->FindParm( "Length", "Design" );
+    string x_id = veh.FindGeom( id_vec[1] )->FindParm( "X_Rel_Location", "XForm" );
+    TEST_ASSERT( LinkMgr.AddLink( len_id, x_id, false ) );
+
+    //==== Serial - Every Worker Thread Is Taken ====//
+    vector< BndBox > serial_vec;
+    int num_claimed = ClaimWorkerThreads( GetFreeWorkerThreads() );
+    SetPodsAndUpdate( veh, id_vec, 2.0, serial_vec );
+    ReleaseWorkerThreads( num_claimed );
+
+    //==== Back To The Start, Then Concurrent ====//
+    int num_added = AddTestWorkers();
+    vector< BndBox > parallel_vec;
+    SetPodsAndUpdate( veh, id_vec, 1.0, parallel_vec );
+    SetPodsAndUpdate( veh, id_vec, 2.0, parallel_vec );
+    ClaimWorkerThreads( num_added );
+
+    TEST_ASSERT( serial_vec.size() == parallel_vec.size() );
+    for ( int i = 0 ; i < ( int )serial_vec.size() && i < ( int )parallel_vec.size() ; i++ )
+    {
+        CompareVec3ds( serial_vec[i].GetMin(), parallel_vec[i].GetMin(), "ParallelUpdateTest min" );
+        CompareVec3ds( serial_vec[i].GetMax(), parallel_vec[i].GetMax(), "ParallelUpdateTest max" );
+    }
+
+    //==== Link Followed ====//
+    TEST_ASSERT_DELTA( parallel_vec[1].GetMin().x(), 2.0, 1.0e-6 );
+
+    LinkMgr.DelAllLinks();
+}
+
+//==== Unsafe Siblings Update In Their Place, Between The Concurrent Batches ====//
+void GeomCoreTestSuite::ParallelUpdateOrderTest()
+{
+    Vehicle veh;
+    veh.Init();
+    string parent_id = veh.AddGeom( GeomType( POD_GEOM_TYPE, "POD" ) );
+
+    //==== Two Wings, A Prop, Two Wings - All Children Of The Pod ====//
+    veh.SetActiveGeom( parent_id );
+    vector< Geom* > child_vec;
+    for ( int i = 0 ; i < 5 ; i++ )
+    {
+        GeomType type( MS_WING_GEOM_TYPE, "WING" );
+        if ( i == 2 )
+        {
+            type = GeomType( PROP_GEOM_TYPE, "PROP" );
+        }
+        child_vec.push_back( veh.FindGeom( veh.AddGeom( type ) ) );
+        TEST_ASSERT( child_vec.back() != NULL );
+    }
+    veh.ClearActiveGeom();
+
+    for ( int i = 0 ; i < ( int )child_vec.size() ; i++ )
+    {
+        if ( !child_vec[i] )
+        {
+            return;
+        }
+    }
+
+    //==== Sub-Surfaces On The First And Third Blades ====//
+    Geom* prop = child_vec[2];
+    prop->AddSubSurf( vsp::SS_LINE, 0 );
+    prop->AddSubSurf( vsp::SS_LINE, 2 );
+    SubSurfaceMgr.SetCurrSubSurfInd( 1 );
+    veh.Update();
+    TEST_ASSERT( prop->GetSubSurfVec().size() == 2 );
+
+    //==== Scaling Resets Each Wing's Total Area, Dropping A Blade Resets The Prop's Solidity ====//
+    int num_added = AddTestWorkers();
+
+    for ( int i = 0 ; i < ( int )child_vec.size() ; i++ )
+    {
+        if ( i == 2 )
+        {
+            ParmMgr.FindParm( prop->FindParm( "NumBlade", "Design" ) )->Set( 2 );
+        }
+        else
+        {
+            ParmMgr.FindParm( child_vec[i]->FindParm( "Scale", "XForm" ) )->Set( 2.0 );
+        }
+    }
+    veh.Update();
+
+    ClaimWorkerThreads( num_added );
+
+    //==== Parms Set During Each Update Carry A Later Change Count Than Those Of Earlier Updates ====//
+    int prop_cnt = prop->GetLatestChangeCnt();
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        TEST_ASSERT( child_vec[i]->GetLatestChangeCnt() < prop_cnt );
+        TEST_ASSERT( child_vec[i + 3]->GetLatestChangeCnt() > prop_cnt );
+    }
+
+    //==== Removed Blade's Sub-Surface Is Gone And None Is Selected ====//
+    vector< SubSurface* > ss_vec = prop->GetSubSurfVec();
+    TEST_ASSERT( ss_vec.size() == 1 );
+    if ( ss_vec.size() == 1 )
+    {
+        TEST_ASSERT( ss_vec[0]->m_MainSurfIndx() == 0 );
+    }
+    TEST_ASSERT( SubSurfaceMgr.GetCurrSurfInd() == -1 );
+}
+
+//==== CompGeom With And Without Worker Threads Match ====//
+void GeomCoreTestSuite::CompGeomThreadTest()
+{
+    Vehicle veh;
+    veh.Init();
+
+    GeomType types[3];
+    types[0] = GeomType( POD_GEOM_TYPE, "POD" );
+    types[1] = GeomType( FUSELAGE_GEOM_TYPE, "FUSELAGE" );
+    types[2] = GeomType( MS_WING_GEOM_TYPE, "WING" );
+
+    //==== Overlapping At The Origin, In A Set Of Their Own ====//
+    for ( int g = 0 ; g < 3 ; g++ )
+    {
+        Geom* geom = veh.FindGeom( veh.AddGeom( types[g] ) );
+        TEST_ASSERT( geom != NULL );
+        if ( geom )
+        {
+            geom->SetSetFlag( vsp::SET_FIRST_USER, true );
+        }
+    }
+    veh.Update();
+
+    //==== Serial - Every Worker Thread Is Taken ====//
+    int num_claimed = ClaimWorkerThreads( GetFreeWorkerThreads() );
+    string mesh_serial = veh.CompGeom( vsp::SET_FIRST_USER, vsp::SET_NONE, 0, 1, false );
+    ReleaseWorkerThreads( num_claimed );
+    TEST_ASSERT( mesh_serial.compare( "NONE" ) != 0 );
+
+    MeshGeom* serial_ptr = dynamic_cast< MeshGeom* >( veh.FindGeom( mesh_serial ) );
+    TEST_ASSERT( serial_ptr != NULL );
+    if ( !serial_ptr )
+    {
+        return;
+    }
+    serial_ptr->SetSetFlag( vsp::SET_FIRST_USER, false );
+
+    //==== Concurrent ====//
+    int num_added = AddTestWorkers();
+    string mesh_parallel = veh.CompGeom( vsp::SET_FIRST_USER, vsp::SET_NONE, 0, 1, false );
+    ClaimWorkerThreads( num_added );
+    TEST_ASSERT( mesh_parallel.compare( "NONE" ) != 0 );
+
+    MeshGeom* parallel_ptr = dynamic_cast< MeshGeom* >( veh.FindGeom( mesh_parallel ) );
+    TEST_ASSERT( parallel_ptr != NULL );
+    if ( !parallel_ptr )
+    {
+        return;
+    }
+
+    TEST_ASSERT_DELTA( serial_ptr->m_TotalWetArea, parallel_ptr->m_TotalWetArea, 1.0e-9 );
+    TEST_ASSERT_DELTA( serial_ptr->m_TotalWetVol, parallel_ptr->m_TotalWetVol, 1.0e-9 );
+
+    CompareMeshes( veh, mesh_serial, mesh_parallel );
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
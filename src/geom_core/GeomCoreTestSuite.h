@@ -27,6 +27,12 @@ public:
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::AdvLinkExprTest )
+        TEST_ADD( GeomCoreTestSuite::AdvLinkScriptMatchTest )
+        TEST_ADD( GeomCoreTestSuite::TMeshBvhTest )
+        TEST_ADD( GeomCoreTestSuite::ParallelUpdateTest )
+        TEST_ADD( GeomCoreTestSuite::ParallelUpdateOrderTest )
+        TEST_ADD( GeomCoreTestSuite::CompGeomThreadTest )
     }
 
 private:
@@ -36,6 +42,12 @@ private:
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void AdvLinkExprTest();
+    void AdvLinkScriptMatchTest();
+    void TMeshBvhTest();
+    void ParallelUpdateTest();
+    void ParallelUpdateOrderTest();
+    void CompGeomThreadTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
 
@@ -50,6 +50,7 @@ void LinkMgrSingleton::Wype()
 
     DelAllLinks();
     m_LinkVec = deque< Link* >();
+    m_ParmALinkMap.clear();
 
     m_UpdatedParmVec = vector< string >();
 
@@ -147,6 +148,10 @@ void LinkMgrSingleton::CheckLinks()
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
     }
 
+    if ( del_indices.size() )
+    {
+        RebuildParmALinkMap();
+    }
 }
 
 
@@ -188,10 +193,15 @@ bool LinkMgrSingleton::AddCurrLink()
 //==== Check For Duplicate Link  ====//
 bool LinkMgrSingleton::CheckForDuplicateLink( const string & pA, const string &  pB )
 {
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< string, vector< Link* > >::const_iterator it = m_ParmALinkMap.find( pA );
+    if ( it == m_ParmALinkMap.end() )
+    {
+        return false;
+    }
+
+    for ( int i = 0 ; i < ( int )it->second.size() ; i++ )
     {
-        if ( m_LinkVec[i]->GetParmA() == pA &&
-                m_LinkVec[i]->GetParmB() == pB )
+        if ( it->second[i]->GetParmB() == pB )
         {
             return true;
         }
@@ -217,12 +227,9 @@ bool LinkMgrSingleton::UsedInLink( const string & pid )
 bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool init_link_parms )
 {
     //==== Make Sure Parm Are Not Already Linked ====//
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    if ( CheckForDuplicateLink( pidA, pidB ) )
     {
-        if ( m_LinkVec[i]->GetParmA() == pidA && m_LinkVec[i]->GetParmB() == pidB  )
-        {
-            return false;
-        }
+        return false;
     }
 
     //==== Check If ParmIDs Are Valid ====//
@@ -247,12 +254,29 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool ini
         pl->m_Scale.Set( 1.0 );
     }
 
-    m_LinkVec.push_back( pl );
+    AddLink( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
 
     return true;
 }
 
+//==== Add Link And Index It By Parm A ====//
+void LinkMgrSingleton::AddLink( Link* link )
+{
+    m_LinkVec.push_back( link );
+    m_ParmALinkMap[ link->GetParmA() ].push_back( link );
+}
+
+//==== Index All Links By Parm A ====//
+void LinkMgrSingleton::RebuildParmALinkMap()
+{
+    m_ParmALinkMap.clear();
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        m_ParmALinkMap[ m_LinkVec[i]->GetParmA() ].push_back( m_LinkVec[i] );
+    }
+}
+
 //==== Delete Curr Link ====//
 void LinkMgrSingleton::DelCurrLink()
 {
@@ -264,6 +288,7 @@ void LinkMgrSingleton::DelCurrLink()
     Link* pl = m_LinkVec[m_CurrLinkIndex];
 
     m_LinkVec.erase( m_LinkVec.begin() +  m_CurrLinkIndex );
+    RebuildParmALinkMap();
 
     delete pl;
 
@@ -279,6 +304,7 @@ void LinkMgrSingleton::DelAllLinks()
     }
 
     m_LinkVec.clear();
+    m_ParmALinkMap.clear();
     m_CurrLinkIndex = -1;
 }
 //==== Link All Parms In A Group ====//
@@ -397,12 +423,10 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 
     //==== Look for Reg Links  ====//
     vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< string, vector< Link* > >::const_iterator it = m_ParmALinkMap.find( pid );
+    if ( it != m_ParmALinkMap.end() )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
-        {
-            parm_link_vec.push_back( m_LinkVec[i] );
-        }
+        parm_link_vec = it->second;
     }
 
     //==== Check Links ====//
@@ -416,6 +440,13 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     if ( !adv_link_flag && !reg_link_flag )
         return;
 
+    //==== Propagate Once When The Batch Is Committed ====//
+    if ( start_flag && ParmMgr.IsBatchRecording() )
+    {
+        ParmMgr.AddBatchParm( pid );
+        return;
+    }
+
     //==== Set Link Update Flag ====//
     parm_ptr->SetLinkUpdateFlag( true );
     m_UpdatedParmVec.push_back( parm_ptr->GetID() );
@@ -762,9 +793,11 @@ bool LinkNameCompareB( const Link *lnkA, const Link *lnkB )
 void LinkMgrSingleton::SortLinksByA()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareA );
+    RebuildParmALinkMap();
 }
 
 void LinkMgrSingleton::SortLinksByB()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareB );
+    RebuildParmALinkMap();
 }
@@ -14,9 +14,11 @@
 #include "Link.h"
 #include "UserParmContainer.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Parm Link Manager ====//
@@ -45,7 +47,7 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB, bool init_link_parms = true );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link );
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
@@ -120,6 +122,9 @@ private:
 
     deque< Link* > m_LinkVec;
 
+    unordered_map< string, vector< Link* > > m_ParmALinkMap;   // Parm A ID->Links Driven By It, In m_LinkVec Order
+    void RebuildParmALinkMap();
+
     vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
@@ -24,6 +24,7 @@
 
 #include "SubSurfaceMgr.h"
 #include "VspUtil.h"
+#include "ParallelUtil.h"
 
 //==== Constructor =====//
 MeshGeom::MeshGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
@@ -1927,7 +1928,7 @@ void MeshGeom::IntersectTrim( vector< DegenGeom > &degenGeom, bool degen, int in
 
                     // Make current TMesh XYZ again and reset its octtree
                     m_TMeshVec[i]->MakeNodePntXYZ();
-                    m_TMeshVec[i]->m_TBox.Reset();
+                    m_TMeshVec[i]->m_TBvh.Reset();
 
                     // Flatten Mesh
                     TMesh* f_tmesh = new TMesh();
@@ -1955,25 +1956,16 @@ void MeshGeom::IntersectTrim( vector< DegenGeom > &degenGeom, bool degen, int in
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_TBvh.m_Box );
     }
     m_BBox = b;
     //update_xformed_bbox();          // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+    SplitTMeshes();
 
     //==== Determine Which Triangle Are Interior/Exterior ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2204,6 +2196,51 @@ void MeshGeom::IntersectTrim( vector< DegenGeom > &degenGeom, bool degen, int in
     }
 }
 
+//==== Intersect Every Pair Of TMeshes With Overlapping Bounding Boxes ====//
+// Pairs are intersected concurrently.  Each pair collects its intersection edges on
+// its own and they are added to the tris afterwards in pair order, so the result is
+// the same as intersecting the pairs one after another.  Bounding boxes must be loaded.
+void MeshGeom::IntersectTMeshPairs()
+{
+    vector< std::pair< int, int > > pair_vec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            if ( Compare( m_TMeshVec[i]->m_TBvh.m_Box, m_TMeshVec[j]->m_TBvh.m_Box ) )
+            {
+                pair_vec.push_back( std::make_pair( i, j ) );
+            }
+        }
+    }
+
+    vector< vector< std::pair< TTri*, TEdge* > > > isect_vecs( pair_vec.size() );
+
+    ParallelFor( ( int )pair_vec.size(), [ & ]( int ipair )
+    {
+        m_TMeshVec[ pair_vec[ipair].first ]->Intersect( m_TMeshVec[ pair_vec[ipair].second ], isect_vecs[ipair] );
+    } );
+
+    for ( int p = 0 ; p < ( int )isect_vecs.size() ; p++ )
+    {
+        for ( int e = 0 ; e < ( int )isect_vecs[p].size() ; e++ )
+        {
+            isect_vecs[p][e].first->m_ISectEdgeVec.push_back( isect_vecs[p][e].second );
+        }
+    }
+}
+
+//==== Split Intersected Tris, Each TMesh Is Split Concurrently ====//
+// Finding each tri's sub-edges and nodes runs concurrently, the Triangle calls
+// themselves take turns, see TTri::TriangulateSplit.
+void MeshGeom::SplitTMeshes()
+{
+    ParallelFor( ( int )m_TMeshVec.size(), [ & ]( int i )
+    {
+        m_TMeshVec[i]->Split();
+    } );
+}
+
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                           bool autoBounds, double start, double end )
@@ -2323,7 +2360,7 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_TBvh.m_Box );
     }
     m_BBox = b;
 
@@ -2582,7 +2619,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
 
                 // Make current m_TMeshVec[i] XYZ again and reset its octtree
                 m_TMeshVec[i]->MakeNodePntXYZ();
-                m_TMeshVec[i]->m_TBox.Reset();
+                m_TMeshVec[i]->m_TBvh.Reset();
 
                 // Get and count negative and positive norm x values for all tris in current subsurface
                 int negnorm = 0;
@@ -2767,23 +2804,14 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     m_BBox.Reset();
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_BBox.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        m_BBox.Update( m_TMeshVec[i]->m_TBvh.m_Box );
     }
 
     //==== Intersect All Mesh Geoms (before slicing) ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+    SplitTMeshes();
 
     WaveDragMgr.m_XNorm.resize( numSlices );
     for ( int islice = 0 ; islice < numSlices ; islice++ )
@@ -3004,7 +3032,7 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_TBvh.m_Box );
     }
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
@@ -3086,19 +3114,10 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     }
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+    SplitTMeshes();
 
     //==== Determine Which Triangle Are Interior/Exterior ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -3462,7 +3481,7 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_TBvh.m_Box );
     }
     m_BBox = b;
     //update_xformed_bbox();          // Load Xform BBox
@@ -3541,19 +3560,10 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
+    SplitTMeshes();
 
     //==== Determine Which Triangle Are Interior/Exterior ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
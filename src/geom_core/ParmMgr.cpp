@@ -20,9 +20,12 @@ ParmMgrSingleton::ParmMgrSingleton()
 {
     m_NumParmChanges = 0;
     m_ChangeCnt = 0;
+    m_ConcurrentUpdate = false;
     m_LastUndoFlag = false;
     m_LastReset = "";
     m_DirtyFlag = true;
+    m_BatchDepth = 0;
+    m_BatchCommitFlag = false;
 }
 
 //==== Add Parm To Map ====//
@@ -40,6 +43,8 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
         return false;
     }
 
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     //==== Check If Already Added ====//
     if ( m_ParmMap.find( p->GetID() ) != m_ParmMap.end() )
     {
@@ -57,6 +62,8 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
 //==== Remove Parm From Map ====//
 void ParmMgrSingleton::RemoveParm( Parm* p  )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     unordered_map< string, Parm* >::iterator iter;
     iter = m_ParmMap.find( p->GetID() );
 
@@ -72,6 +79,8 @@ void ParmMgrSingleton::RemoveParm( Parm* p  )
 //==== Add Parm Container To Map ====//
 void ParmMgrSingleton::AddParmContainer( ParmContainer* pc  )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     if ( pc )
     {
         m_NumParmChanges++;
@@ -84,6 +93,8 @@ void ParmMgrSingleton::AddParmContainer( ParmContainer* pc  )
 //==== Remove Parm Container From Map ====//
 void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     unordered_map< string, ParmContainer* >::iterator iter;
     iter = m_ParmContainerMap.find( pc->GetID() );
 
@@ -99,6 +110,8 @@ void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
 //==== Find Parm GivenID ====//
 Parm* ParmMgrSingleton::FindParm( const string & id )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     unordered_map< string, Parm* >::iterator iter;
 
     iter = m_ParmMap.find( id );
@@ -112,6 +125,8 @@ Parm* ParmMgrSingleton::FindParm( const string & id )
 //==== Find Parm Name Group Container ====//
 string ParmMgrSingleton::FindParmID( const string & name, const string & group, const string & container )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     unordered_map< string, Parm* >::iterator iter;
 
     for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; ++iter )
@@ -135,6 +150,8 @@ string ParmMgrSingleton::FindParmID( const string & name, const string & group,
 //==== Find Parm Container GivenID ====//
 ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 {
+    std::unique_lock< std::mutex > lock = LockMaps();
+
     unordered_map< string, ParmContainer* >::iterator iter;
 
     iter = m_ParmContainerMap.find( id );
@@ -184,6 +201,50 @@ void ParmMgrSingleton::UnDo()
     }
 }
 
+//==== Close One Level Of Parm Batch ====//
+void ParmMgrSingleton::EndBatch()
+{
+    if ( m_BatchDepth > 0 )
+    {
+        m_BatchDepth--;
+    }
+
+    if ( m_BatchDepth == 0 )
+    {
+        ResetBatch();
+    }
+}
+
+//==== Drop Any Open Parm Batch ====//
+void ParmMgrSingleton::ResetBatch()
+{
+    m_BatchDepth = 0;
+    m_BatchCommitFlag = false;
+    m_BatchParmVec.clear();
+    m_BatchParmSet.clear();
+}
+
+//==== Record Linked Parm Set During Batch, Once ====//
+void ParmMgrSingleton::AddBatchParm( const string & id )
+{
+    if ( m_BatchParmSet.insert( id ).second )
+    {
+        m_BatchParmVec.push_back( id );
+    }
+}
+
+//==== Stop Recording And Return The Linked Parms To Propagate ====//
+vector< string > ParmMgrSingleton::StartBatchCommit()
+{
+    m_BatchCommitFlag = true;
+
+    vector< string > parm_vec;
+    parm_vec.swap( m_BatchParmVec );
+    m_BatchParmSet.clear();
+
+    return parm_vec;
+}
+
 //==== Remap oldID into newID avoiding collisions ====//
 
 // RemapID will map an old set of ID's to a new set of ID's.
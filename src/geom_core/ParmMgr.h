@@ -19,7 +19,10 @@
 
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <stack>
+#include <atomic>
+#include <mutex>
 
 using std::string;
 using std::unordered_map;
@@ -41,17 +44,34 @@ private:
 
     unordered_map< string, Parm* > m_ParmMap;                       // ID->Parm Map
     unordered_map< string, ParmContainer* > m_ParmContainerMap;     // ID->Parm Container Map
+    std::mutex m_MapMutex;                                          // Guards both maps while geoms update concurrently
+    std::atomic< bool > m_ConcurrentUpdate;                         // Geom updates are running on worker threads, lock the maps
 
     unordered_map< string, string > m_IDRemap;                      // oldID->newID Map
     string m_LastReset;
 
-    int m_NumParmChanges;
-    int m_ChangeCnt;
+    std::atomic< int > m_NumParmChanges;
+    std::atomic< int > m_ChangeCnt;                                 // Bumped by concurrent geom updates
 
     bool m_DirtyFlag;
 
+    int m_BatchDepth;                                               // Nesting depth of open parm batches
+    bool m_BatchCommitFlag;                                         // Batch is being committed
+    vector< string > m_BatchParmVec;                                // Linked parms set during the batch, in set order
+    std::unordered_set< string > m_BatchParmSet;
+
     string RemapID( const string & oldID, const string & suggestID, int size );
 
+    //==== Lock The Maps Only While Geoms Update Concurrently, Otherwise Return An Empty Lock ====//
+    std::unique_lock< std::mutex > LockMaps()
+    {
+        if ( m_ConcurrentUpdate.load( std::memory_order_relaxed ) )
+        {
+            return std::unique_lock< std::mutex >( m_MapMutex );
+        }
+        return std::unique_lock< std::mutex >();
+    }
+
 public:
     static ParmMgrSingleton& getInstance()
     {
@@ -79,7 +99,10 @@ public:
     Parm* GetActiveParm()                   { return FindParm( m_ActiveParmID ); }
     int GetNumParmChanges()                 { return m_NumParmChanges; }
     void IncNumParmChanges()                { m_NumParmChanges++; }
-    int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetChangeCnt()                      { return ++m_ChangeCnt; }
+
+    //==== Set By Vehicle::UpdateGeoms Around Its Concurrent Batches, Before Workers Start And After They Join ====//
+    void SetConcurrentUpdate( bool flag )   { m_ConcurrentUpdate = flag; }
 
     static Parm* CreateParm( int type );
 
@@ -89,6 +112,16 @@ public:
     bool GetDirtyFlag()                     { return m_DirtyFlag; }
     void SetDirtyFlag( bool flag )          { m_DirtyFlag = flag; }
 
+    //==== Parm Batches Defer Link, Geom And GUI Updates Until Committed, See Vehicle::EndParmBatch ====//
+    void BeginBatch()                       { m_BatchDepth++; }
+    void EndBatch();
+    void ResetBatch();
+    int GetBatchDepth()                     { return m_BatchDepth; }
+    bool IsBatchOpen()                      { return m_BatchDepth > 0; }
+    bool IsBatchRecording()                 { return m_BatchDepth > 0 && !m_BatchCommitFlag; }
+    void AddBatchParm( const string & id );
+    vector< string > StartBatchCommit();
+
 };
 
 #define ParmMgr ParmMgrSingleton::getInstance()
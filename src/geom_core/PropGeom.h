@@ -137,6 +137,12 @@ public:
 
     virtual void AddLinkableParms( vector< string > & linkable_parm_vec, const string & link_container_id = string() );
     virtual void Scale();
+
+    //==== UpdateSurf Deletes Sub-Surfaces Of Removed Blades Through SubSurfaceMgr ====//
+    virtual bool IsParallelUpdateSafe()
+    {
+        return false;
+    }
     virtual void AddDefaultSources( double base_len = 1.0 );
 
     virtual string BuildBEMResults();
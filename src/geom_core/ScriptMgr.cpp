@@ -252,6 +252,7 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
     }
 
     //==== Start A New Module ====//
+    ClearModuleCache( updated_module_name );
     r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
     if( r < 0 )        return string();
 
@@ -298,6 +299,7 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
 
     m_ModuleContentMap.erase( iter );
 
+    ClearModuleCache( module_name );
     int ret = m_ScriptEngine->DiscardModule( module_name.c_str() );
 
     if ( ret < 0 )
@@ -310,52 +312,142 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
 int ScriptMgrSingleton::ExecuteScript( const char* module_name, const char* function_name, bool arg_flag, double arg, bool by_decl )
 {
     // Find the function that is to be called.
+    asIScriptFunction *func = FindFunction( module_name, function_name, by_decl );
+
+    if( func == 0 )
+    {
+        return 1;
+    }
+
+    // Get a pooled context, prepare it, and then execute
+    asIScriptContext *ctx = RequestContext( func );
+    if ( arg_flag )
+    {
+        ctx->SetArgDouble( 0, arg );
+    }
+    int r = ctx->Execute();
+    if( r != asEXECUTION_FINISHED )
+    {
+        // The execution didn't complete as expected. Determine what happened.
+        if( r == asEXECUTION_EXCEPTION )
+        {
+            // An exception occurred, let the script writer know what happened so it can be corrected.
+            printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
+        }
+        ReturnContext( ctx );
+        return 1;
+    }
+
+    asDWORD ret = ctx->GetReturnDWord();
+    int32_t rval = ret;
+
+    ReturnContext( ctx );
+
+    return rval;
+}
+
+//==== Find Function In Module, Lookups By Declaration Are Cached Until The Module Is Rebuilt ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const char* module_name, const char* function_name, bool by_decl )
+{
+    map< string, asIScriptFunction* >* func_map = NULL;
+    if ( by_decl )
+    {
+        func_map = &m_ModuleFunctionMap[ module_name ];
+        map< string, asIScriptFunction* >::iterator iter = func_map->find( function_name );
+        if ( iter != func_map->end() )
+        {
+            return iter->second;
+        }
+    }
+
     asIScriptModule *mod = m_ScriptEngine->GetModule( module_name );
 
     if ( !mod )
     {
         printf( "Error ExecuteScript GetModule %s\n", module_name );
-        return 1;
+        if ( func_map && func_map->empty() )
+        {
+            m_ModuleFunctionMap.erase( module_name );
+        }
+        return NULL;
     }
 
     asIScriptFunction *func = NULL;
     if ( by_decl )
     {
         func = mod->GetFunctionByDecl( function_name );
+        ( *func_map )[ function_name ] = func;          // Optional hooks are often missing, remember that too
     }
     else
     {
         func = mod->GetFunctionByName( function_name );
     }
 
-    if( func == 0 )
+    return func;
+}
+
+//==== Forget Functions Of Module Before It Is Rebuilt Or Discarded ====//
+void ScriptMgrSingleton::ClearModuleCache( const string & module_name )
+{
+    m_ModuleFunctionMap.erase( module_name );
+
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
     {
-        return 1;
+        return;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
-    ctx->Prepare( func );
-    if ( arg_flag )
+    //==== Release Functions Still Held By Idle Contexts ====//
+    vector< asIScriptContext* > & pool = m_ContextPool;
+    for ( int i = 0 ; i < ( int )pool.size() ; i++ )
     {
-        ctx->SetArgDouble( 0, arg );
+        asIScriptFunction* func = pool[i]->GetFunction();
+        if ( func && func->GetModule() == mod )
+        {
+            pool[i]->Unprepare();
+        }
     }
-    int r = ctx->Execute();
-    if( r != asEXECUTION_FINISHED )
+}
+
+//==== Get Context For Function, Preferring One Already Prepared With It ====//
+asIScriptContext* ScriptMgrSingleton::RequestContext( asIScriptFunction* func )
+{
+    asIScriptContext* ctx = NULL;
+    vector< asIScriptContext* > & pool = m_ContextPool;
+
+    if ( !pool.empty() )
     {
-        // The execution didn't complete as expected. Determine what happened.
-        if( r == asEXECUTION_EXCEPTION )
+        int index = ( int )pool.size() - 1;
+        for ( int i = index ; i >= 0 ; i-- )
         {
-            // An exception occurred, let the script writer know what happened so it can be corrected.
-            printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
+            if ( pool[i]->GetFunction() == func )
+            {
+                index = i;
+                break;
+            }
         }
-        return 1;
+        ctx = pool[index];
+        pool[index] = pool.back();
+        pool.pop_back();
+    }
+    else
+    {
+        ctx = m_ScriptEngine->CreateContext();
     }
 
-    asDWORD ret = ctx->GetReturnDWord();
-    int32_t rval = ret;
+    // Preparing again with the same function skips most of the setup
+    ctx->Prepare( func );
+    return ctx;
+}
 
-    return rval;
+//==== Return Context To Pool, Still Prepared If It Ran To The End ====//
+void ScriptMgrSingleton::ReturnContext( asIScriptContext* ctx )
+{
+    if ( ctx->GetState() != asEXECUTION_FINISHED )
+    {
+        ctx->Unprepare();
+    }
+    m_ContextPool.push_back( ctx );
 }
 
 //==== Return Script Content Given Module Name ====//
@@ -9186,6 +9278,47 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
                                     vspFUNCTIONPR( vsp::SetParmValUpdate, ( const string &, const string &, const string &, double val ), double ), vspCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
+    doc_struct.comment = R"(
+/*!
+    Start a batch of Parm changes. Until EndParmBatch is called, setting a Parm only marks its Geom for update and records
+    whether it drives any links. Batches may be nested; only the outermost EndParmBatch commits.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    BeginParmBatch();
+
+    SetParmVal( pod_id, "X_Rel_Location", "XForm", 5.0 );
+    SetParmVal( pod_id, "Y_Rel_Location", "XForm", 1.0 );
+    SetParmVal( pod_id, "Length", "Design", 12.0 );
+
+    EndParmBatch();
+    \endcode
+    \sa EndParmBatch, SetParmVal
+*/)";
+    r = se->RegisterGlobalFunction( "void BeginParmBatch()", vspFUNCTION( vsp::BeginParmBatch ), vspCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Commit the batch of Parm changes started by BeginParmBatch. The links driven by the changed Parms are propagated once,
+    then the Vehicle, its bounding box and the screens are each updated once.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    BeginParmBatch();
+
+    SetParmVal( pod_id, "X_Rel_Location", "XForm", 5.0 );
+    SetParmVal( pod_id, "Length", "Design", 12.0 );
+
+    EndParmBatch();
+    \endcode
+    \sa BeginParmBatch, Update
+*/)";
+    r = se->RegisterGlobalFunction( "void EndParmBatch()", vspFUNCTION( vsp::EndParmBatch ), vspCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
     doc_struct.comment = R"(
 /*!
     Get the value of the specified Parm. The data type of the Parm value will be cast to a double
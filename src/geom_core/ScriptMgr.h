@@ -156,11 +156,23 @@ private:
     static void RegisterAPI( asIScriptEngine* se );
     static void RegisterUtility( asIScriptEngine* se );
 
+    //==== Function Lookup And Context Reuse For ExecuteScript ====//
+    asIScriptFunction* FindFunction( const char* module_name, const char* function_name, bool by_decl );
+    void ClearModuleCache( const string & module_name );
+    asIScriptContext* RequestContext( asIScriptFunction* func );
+    void ReturnContext( asIScriptContext* ctx );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
 //    map< string, CScriptBuilder > m_BuilderMap;
     CScriptBuilder m_ScriptBuilder;
     map< string, string > m_ModuleContentMap;
+    map< string, map< string, asIScriptFunction* > > m_ModuleFunctionMap;     // Module -> Decl -> Function (NULL If Missing)
+
+    // Idle contexts, kept prepared for reuse.  Scripts only run on the main thread:
+    // custom geoms and geoms reached by advanced links are never updated on workers,
+    // see Vehicle::UpdateGeoms, so one pool serves every ExecuteScript call.
+    vector< asIScriptContext* > m_ContextPool;
     string m_ScriptMessages;
 
     //==== Test Proxy Stuff ====//
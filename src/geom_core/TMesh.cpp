@@ -24,6 +24,7 @@
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
+#include "ParallelUtil.h"
 #include "VspCurve.h" // for #define TMAGIC
 
 #include "triangle.h"
@@ -31,6 +32,12 @@
 
 
 #include <math.h>
+#include <limits>
+#include <mutex>
+
+// Triangle keeps its random seed and robust predicate constants in globals that
+// every context resets, so TMeshes split concurrently take turns triangulating.
+static std::mutex s_TriangleMutex;
 
 //===============================================//
 //                  TNode
@@ -781,17 +788,22 @@ void TMesh::MergeTMeshes( TMesh* tm )
 
 void TMesh::Intersect( TMesh* tm, bool UWFlag )
 {
-    m_TBox.Intersect( &tm->m_TBox, UWFlag );
+    m_TBvh.Intersect( &tm->m_TBvh, UWFlag );
+}
+
+void TMesh::Intersect( TMesh* tm, vector< std::pair< TTri*, TEdge* > > & isect_vec )
+{
+    m_TBvh.Intersect( &tm->m_TBvh, isect_vec );
 }
 
 bool TMesh::CheckIntersect( TMesh* tm )
 {
-    return m_TBox.CheckIntersect( &tm->m_TBox );
+    return m_TBvh.CheckIntersect( &tm->m_TBvh );
 }
 
 double TMesh::MinDistance( TMesh* tm, double curr_min_dist )
 {
-    return m_TBox.MinDistance( &tm->m_TBox, curr_min_dist );
+    return m_TBvh.MinDistance( &tm->m_TBvh, curr_min_dist );
 }
 
 void TMesh::Split()
@@ -934,53 +946,83 @@ void TMesh::IgnoreYLessThan( const double & ytol )
 
 void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
+    //==== Tris To Classify, Split Tris Are Replaced By Their Pieces ====//
+    vector< TTri* > tri_vec;
+    tri_vec.reserve( m_TVec.size() );
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
 
-        //==== Do Interior Tris ====//
         if ( tri->m_SplitVec.size() )
         {
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
+            tri_vec.insert( tri_vec.end(), tri->m_SplitVec.begin(), tri->m_SplitVec.end() );
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            tri_vec.push_back( tri );
         }
     }
+
+    //==== Classify Runs Of Neighboring Tris As Ray Packets ====//
+    // Each tri's result only depends on the other meshes, so runs can be classified
+    // in any order and match classifying one tri at a time.
+    const int packet_size = 64;
+    int npacket = ( ( int )tri_vec.size() + packet_size - 1 ) / packet_size;
+
+    ParallelFor( npacket, [ & ]( int ipacket )
+    {
+        int istart = ipacket * packet_size;
+        int iend = std::min( istart + packet_size, ( int )tri_vec.size() );
+
+        DeterIntExtTris( tri_vec, istart, iend, meshVec );
+    } );
 }
 
-void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+//==== Classify tri_vec[istart] ... tri_vec[iend - 1] With One Packet Per Mesh ====//
+void TMesh::DeterIntExtTris( vector< TTri* > & tri_vec, int istart, int iend, vector< TMesh* >& meshVec )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_IgnoreTriFlag = false;
-    int prior = -1;
-
-    vec3d dir( 1.0, 0.000001, 0.000001 );
+    static thread_local vector< vec3d > orig_vec;
+    static thread_local vector< int > prior_vec;
+    static thread_local vector< vector< double > > tparm_vecs;
 
+    int ntri = iend - istart;
     int nmesh = meshVec.size();
-    tri->m_insideSurf.resize( nmesh, false );
+
+    orig_vec.resize( ntri );
+    prior_vec.assign( ntri, -1 );
+
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        TTri* tri = tri_vec[ istart + i ];
+
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+        orig_vec[i] = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+        tri->m_IgnoreTriFlag = false;
+        tri->m_insideSurf.resize( nmesh, false );
+    }
+
+    vec3d dir( 1.0, 0.000001, 0.000001 );
 
     for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
     {
         if ( meshVec[m] != this && meshVec[m]->m_ThickSurf )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
-            {
-                tri->m_insideSurf[m] = true;
+            meshVec[m]->m_TBvh.RayCastPacket( orig_vec, dir, tparm_vecs );
 
-                // Priority assignment for wave drag.  Mass prop may need some adjustments.
-                if ( meshVec[m]->m_MassPrior > prior ) // Should possibly check that priority is only for vsp::CFD_NORMAL
+            for ( int i = 0 ; i < ntri ; i++ )
+            {
+                if ( tparm_vecs[i].size() % 2 )
                 {
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    tri->m_Density = meshVec[m]->m_Density;
-                    prior = meshVec[m]->m_MassPrior;
+                    TTri* tri = tri_vec[ istart + i ];
+                    tri->m_insideSurf[m] = true;
+
+                    // Priority assignment for wave drag.  Mass prop may need some adjustments.
+                    if ( meshVec[m]->m_MassPrior > prior_vec[i] ) // Should possibly check that priority is only for vsp::CFD_NORMAL
+                    {
+                        tri->m_ID = meshVec[m]->m_PtrID;
+                        tri->m_Density = meshVec[m]->m_Density;
+                        prior_vec[i] = meshVec[m]->m_MassPrior;
+                    }
                 }
             }
         }
@@ -1295,14 +1337,7 @@ void TMesh::AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, c
 
 void TMesh::LoadBndBox()
 {
-    m_TBox.Reset();
-
-    for ( int i = 0 ; i < ( int )m_TVec.size() ; i++ )
-    {
-        m_TBox.AddTri( m_TVec[i] );
-    }
-
-    m_TBox.SplitBox();
+    m_TBvh.Build( m_TVec );
 }
 
 //==== Write STL Tris =====//
@@ -1405,9 +1440,6 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_IgnoreTriFlag = false;
@@ -1419,9 +1451,6 @@ TTri::TTri()
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -1985,9 +2014,6 @@ void TTri::TriangulateSplit( int flattenAxis )
     triangleio in, out;
     int tristatus = TRI_NULL;
 
-    // init
-    ctx = triangle_context_create();
-
     memset( &in, 0, sizeof( in ) ); // Load Zeros
     memset( &out, 0, sizeof( out ) );
 
@@ -2130,6 +2156,11 @@ void TTri::TriangulateSplit( int flattenAxis )
         {
             char cmdline[] = "zpQ";
 
+            std::lock_guard< std::mutex > lock( s_TriangleMutex );
+
+            // init
+            ctx = triangle_context_create();
+
             //==== Constrained Delaunay Trianglulation ====//
             tristatus = triangle_context_options( ctx, cmdline );
             if ( tristatus != TRI_OK ) printf( "triangle_context_options Error\n" );
@@ -2137,14 +2168,20 @@ void TTri::TriangulateSplit( int flattenAxis )
             // Triangulate the polygon
             tristatus = triangle_mesh_create( ctx, &in );
             if ( tristatus != TRI_OK ) printf( "triangle_mesh_create Error\n" );
+
+            if ( tristatus == TRI_OK )
+            {
+                triangle_mesh_copy( ctx, &out, 1, 1 );
+            }
+
+            // cleanup
+            triangle_context_destroy( ctx );
         }
 //fprintf(fp, "Triangulate in = %d out = %d \n", in.numberofpoints, out.numberofpoints );
     }
 
     if ( tristatus == TRI_OK )
     {
-        triangle_mesh_copy( ctx, &out, 1, 1 );
-
         //==== Load Triangles if No New Point Created ====//
         cnt = 0;
         for ( i = 0; i < out.numberoftriangles; i++ )
@@ -2232,9 +2269,6 @@ void TTri::TriangulateSplit( int flattenAxis )
 
     //free( in.edgelist );
     //free( in.edgemarkerlist );
-
-    // cleanup
-    triangle_context_destroy( ctx );
 }
 
 int TTri::OnEdge( const vec3d & p, TEdge* e, double onEdgeTol, double * t )
@@ -2369,6 +2403,121 @@ int TTri::WakeEdge()
 
 
 
+//==== Add Intersection Edges For A Pair Of Tris ====//
+// Without UWFlag the edges can be collected in isect_vec instead of being added to the
+// tris, so pairs of meshes can be intersected concurrently and the edges added after.
+static void IntersectTris( TTri* t0, TTri* t1, bool UWFlag, vector< std::pair< TTri*, TEdge* > > * isect_vec )
+{
+    double tol = 1e-6; // was 1e-6
+
+    int coplanarFlag = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
+    vec3d e0;
+    vec3d e1;
+
+    int iflag = tri_tri_intersection_test_3d(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, e0.v, e1.v );
+
+    if ( iflag && !coplanarFlag )
+    {
+        if ( UWFlag )
+        {
+            if ( dist( e0, e1 ) > tol ) // was 1e-6
+            {
+                // Figure out with tri has xyz info
+                TTri* tri;
+                int d_info = TNode::HAS_XYZ; // desired info number
+                if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                        && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+                {
+                    tri = t0;
+                }
+                else
+                {
+                    tri = t1;
+                }
+                // Use Bilinear interpolation to convert edge uw points to xyz points
+                vec3d e0xyz = tri->CompPnt( e0 );
+                vec3d e1xyz = tri->CompPnt( e1 );
+
+                // Create the new edges
+
+                TEdge* ie0 = new TEdge();
+                int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                ie0->m_N0 = new TNode();
+                ie0->m_N0->SetUWPnt( e0 );
+                ie0->m_N0->SetXYZPnt( e0xyz );
+                ie0->m_N0->MakePntUW();
+                ie0->m_N0->SetCoordInfo( info );
+                ie0->m_N1 = new TNode();
+                ie0->m_N1->SetUWPnt( e1 );
+                ie0->m_N1->SetXYZPnt( e1xyz );
+                ie0->m_N1->MakePntUW();
+                ie0->m_N1->SetCoordInfo( info );
+
+                TEdge* ie1 = new TEdge();
+                ie1->m_N0 = new TNode();
+                ie1->m_N0->SetUWPnt( e0 );
+                ie1->m_N0->SetXYZPnt( e0xyz );
+                ie1->m_N0->MakePntUW();
+                ie1->m_N0->SetCoordInfo( info );
+                ie1->m_N1 = new TNode();
+                ie1->m_N1->SetUWPnt( e1 );
+                ie1->m_N1->SetXYZPnt( e1xyz );
+                ie1->m_N1->MakePntUW();
+                ie1->m_N1->SetCoordInfo( info );
+
+                t0->m_ISectEdgeVec.push_back( ie0 );
+                t1->m_ISectEdgeVec.push_back( ie1 );
+
+                if ( tri->GetTMeshPtr() )
+                {
+                    tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                }
+
+            }
+        }
+        else
+        {
+            if ( dist( e0, e1 ) > tol )
+            {
+                TEdge* ie0 = new TEdge();
+                int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                ie0->m_N0 = new TNode();
+                ie0->m_N0->m_Pnt = e0;
+                ie0->m_N0->m_UWPnt = t0->CompUW( e0 );
+                ie0->m_N0->SetCoordInfo( info );
+                ie0->m_N1 = new TNode();
+                ie0->m_N1->m_Pnt = e1;
+                ie0->m_N1->m_UWPnt = t0->CompUW( e1 );
+                ie0->m_N1->SetCoordInfo( info );
+
+                TEdge* ie1 = new TEdge();
+                ie1->m_N0 = new TNode();
+                ie1->m_N0->m_Pnt = e0;
+                ie1->m_N0->m_UWPnt = t1->CompUW( e0 );
+                ie1->m_N0->SetCoordInfo( info );
+                ie1->m_N1 = new TNode();
+                ie1->m_N1->m_Pnt = e1;
+                ie1->m_N1->m_UWPnt = t1->CompUW( e1 );
+                ie1->m_N1->SetCoordInfo( info );
+
+                if ( isect_vec )
+                {
+                    isect_vec->push_back( std::make_pair( t0, ie0 ) );
+                    isect_vec->push_back( std::make_pair( t1, ie1 ) );
+                }
+                else
+                {
+                    t0->m_ISectEdgeVec.push_back( ie0 );
+                    t1->m_ISectEdgeVec.push_back( ie1 );
+                }
+            }
+        }
+    }
+}
+
 //===============================================//
 //===============================================//
 //===============================================//
@@ -2575,8 +2724,6 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
 {
     int i;
 
-    double tol = 1e-6; // was 1e-6
-
     if ( !Compare( m_Box, iBox->m_Box ) )
     {
         return;
@@ -2600,109 +2747,9 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
     {
         for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
         {
-            TTri* t0 = m_TriVec[i];
             for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
-
-                int coplanarFlag = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
-                vec3d e0;
-                vec3d e1;
-
-                int iflag = tri_tri_intersection_test_3d(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
-
-                if ( iflag && !coplanarFlag )
-                {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > tol ) // was 1e-6
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
-
-                        }
-                    }
-                    else
-                    {
-                        if ( dist( e0, e1 ) > tol )
-                        {
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->m_Pnt = e0;
-                            ie0->m_N0->m_UWPnt = t0->CompUW( e0 );
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->m_Pnt = e1;
-                            ie0->m_N1->m_UWPnt = t0->CompUW( e1 );
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->m_Pnt = e0;
-                            ie1->m_N0->m_UWPnt = t1->CompUW( e0 );
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->m_Pnt = e1;
-                            ie1->m_N1->m_UWPnt = t1->CompUW( e1 );
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                    }
-                }
+                IntersectTris( m_TriVec[i], iBox->m_TriVec[j], UWFlag, NULL );
             }
         }
     }
@@ -2759,6 +2806,548 @@ void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
 
 }
 
+//===============================================//
+//===============================================//
+//===============================================//
+//===============================================//
+//                  TBvh
+//===============================================//
+//===============================================//
+//===============================================//
+//===============================================//
+
+TBvh::TBvh()
+{
+}
+
+TBvh::~TBvh()
+{
+}
+
+void TBvh::Reset()
+{
+    m_Box.Reset();
+    m_NodeVec.clear();
+    m_TriVec.clear();
+}
+
+double TBvh::HalfArea( const BndBox & box )
+{
+    vec3d d = box.GetMax() - box.GetMin();
+    return d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+}
+
+//==== Squared Gap Between Boxes, Zero If They Overlap ====//
+double TBvh::BoxDist2( const BndBox & b0, const BndBox & b1 )
+{
+    double d2 = 0.0;
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        double gap = std::max( b0.GetMin( i ) - b1.GetMax( i ), b1.GetMin( i ) - b0.GetMax( i ) );
+        if ( gap > 0.0 )
+        {
+            d2 += gap * gap;
+        }
+    }
+    return d2;
+}
+
+//==== Build Tree With Binned Surface Area Heuristic ====//
+void TBvh::Build( const vector< TTri* > & tri_vec )
+{
+    const int max_leaf_tris = 4;        // Always split above this
+    const int max_sah_leaf_tris = 16;   // Split above this even if SAH prefers a leaf
+    const int num_bins = 16;
+
+    Reset();
+
+    int ntri = ( int )tri_vec.size();
+    if ( ntri == 0 )
+    {
+        return;
+    }
+
+    //==== Tri Bounds And Centers, Partitioned In Place As The Tree Is Built ====//
+    struct BuildTri
+    {
+        BndBox m_Box;
+        vec3d m_Cen;
+        int m_Indx;
+    };
+
+    vector< BuildTri > build_vec( ntri );
+    BndBox root_cen_box;
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        TTri* t = tri_vec[i];
+        BuildTri & bt = build_vec[i];
+        bt.m_Box.Update( t->m_N0->m_Pnt );
+        bt.m_Box.Update( t->m_N1->m_Pnt );
+        bt.m_Box.Update( t->m_N2->m_Pnt );
+        bt.m_Cen = ( bt.m_Box.GetMin() + bt.m_Box.GetMax() ) * 0.5;
+        bt.m_Indx = i;
+        m_Box.Update( bt.m_Box );
+        root_cen_box.Update( bt.m_Cen );
+    }
+
+    TBvhNode root;
+    root.m_Box = m_Box;
+    root.m_Start = 0;
+    root.m_Count = ntri;
+    m_NodeVec.reserve( 2 * ( ntri / max_leaf_tris ) + 1 );
+    m_NodeVec.push_back( root );
+
+    // Nodes waiting to be split, with the bounds of their tri centers
+    vector< std::pair< int, BndBox > > work_stack;
+    work_stack.push_back( std::make_pair( 0, root_cen_box ) );
+
+    BndBox bin_box[ num_bins ];
+    BndBox bin_cen_box[ num_bins ];
+    int bin_cnt[ num_bins ];
+    double right_cost[ num_bins ];
+
+    while ( !work_stack.empty() )
+    {
+        int n = work_stack.back().first;
+        BndBox cen_box = work_stack.back().second;
+        work_stack.pop_back();
+
+        int start = m_NodeVec[n].m_Start;
+        int count = m_NodeVec[n].m_Count;
+
+        if ( count <= max_leaf_tris )
+        {
+            continue;
+        }
+
+        //==== Split Along Longest Axis Of Tri Centers ====//
+        int axis = 0;
+        vec3d ext = cen_box.GetMax() - cen_box.GetMin();
+        if ( ext[1] > ext[axis] )
+        {
+            axis = 1;
+        }
+        if ( ext[2] > ext[axis] )
+        {
+            axis = 2;
+        }
+
+        if ( ext[axis] <= 0.0 )     // Coincident centers can not be separated
+        {
+            continue;
+        }
+
+        double cmin = cen_box.GetMin( axis );
+        double scale = num_bins / ext[axis];
+
+        for ( int b = 0 ; b < num_bins ; b++ )
+        {
+            bin_box[b].Reset();
+            bin_cen_box[b].Reset();
+            bin_cnt[b] = 0;
+        }
+
+        for ( int i = start ; i < start + count ; i++ )
+        {
+            const BuildTri & bt = build_vec[i];
+            int b = std::min( ( int )( ( bt.m_Cen[axis] - cmin ) * scale ), num_bins - 1 );
+            bin_box[b].Update( bt.m_Box );
+            bin_cen_box[b].Update( bt.m_Cen );
+            bin_cnt[b]++;
+        }
+
+        //==== Cost Of Each Split Plane Between Bins ====//
+        BndBox acc_box;
+        int acc_cnt = 0;
+        for ( int b = num_bins - 1 ; b > 0 ; b-- )
+        {
+            acc_box.Update( bin_box[b] );
+            acc_cnt += bin_cnt[b];
+            right_cost[b] = acc_cnt > 0 ? acc_cnt * HalfArea( acc_box ) : 0.0;
+        }
+
+        double best_cost = std::numeric_limits< double >::max();
+        int best_split = -1;
+        acc_box.Reset();
+        acc_cnt = 0;
+        for ( int b = 0 ; b < num_bins - 1 ; b++ )
+        {
+            acc_box.Update( bin_box[b] );
+            acc_cnt += bin_cnt[b];
+            if ( acc_cnt == 0 || acc_cnt == count )
+            {
+                continue;
+            }
+
+            double cost = acc_cnt * HalfArea( acc_box ) + right_cost[b + 1];
+            if ( cost < best_cost )
+            {
+                best_cost = cost;
+                best_split = b;
+            }
+        }
+
+        if ( best_split < 0 )
+        {
+            continue;
+        }
+
+        // Traversal of the two children costs about one tri test
+        double leaf_cost = count * HalfArea( m_NodeVec[n].m_Box );
+        if ( count <= max_sah_leaf_tris && best_cost + HalfArea( m_NodeVec[n].m_Box ) >= leaf_cost )
+        {
+            continue;
+        }
+
+        //==== Partition Tris And Make Children ====//
+        BuildTri* first = &build_vec[start];
+        BuildTri* mid = std::partition( first, first + count, [ & ]( const BuildTri & bt )
+        {
+            return std::min( ( int )( ( bt.m_Cen[axis] - cmin ) * scale ), num_bins - 1 ) <= best_split;
+        } );
+        int nleft = ( int )( mid - first );
+
+        TBvhNode left, right;
+        left.m_Start = start;
+        left.m_Count = nleft;
+        right.m_Start = start + nleft;
+        right.m_Count = count - nleft;
+
+        BndBox left_cen_box, right_cen_box;
+        for ( int b = 0 ; b < num_bins ; b++ )
+        {
+            if ( b <= best_split )
+            {
+                left.m_Box.Update( bin_box[b] );
+                left_cen_box.Update( bin_cen_box[b] );
+            }
+            else
+            {
+                right.m_Box.Update( bin_box[b] );
+                right_cen_box.Update( bin_cen_box[b] );
+            }
+        }
+
+        int ileft = ( int )m_NodeVec.size();
+        m_NodeVec[n].m_Start = ileft;
+        m_NodeVec[n].m_Count = 0;
+        m_NodeVec.push_back( left );
+        m_NodeVec.push_back( right );
+
+        work_stack.push_back( std::make_pair( ileft + 1, right_cen_box ) );
+        work_stack.push_back( std::make_pair( ileft, left_cen_box ) );
+    }
+
+    m_TriVec.resize( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        m_TriVec[i] = tri_vec[ build_vec[i].m_Indx ];
+    }
+}
+
+//==== Visit Leaf Pairs Whose Boxes Are Within Tol, Stop If leaf_func Returns True ====//
+template < typename LeafFunc >
+bool TBvh::TraversePairs( const TBvh* iBvh, const double & tol, LeafFunc leaf_func ) const
+{
+    if ( IsEmpty() || iBvh->IsEmpty() )
+    {
+        return false;
+    }
+
+    vector< std::pair< int, int > > pair_stack;
+    pair_stack.push_back( std::make_pair( 0, 0 ) );
+
+    while ( !pair_stack.empty() )
+    {
+        int a = pair_stack.back().first;
+        int b = pair_stack.back().second;
+        pair_stack.pop_back();
+
+        const TBvhNode & na = m_NodeVec[a];
+        const TBvhNode & nb = iBvh->m_NodeVec[b];
+
+        if ( !Compare( na.m_Box, nb.m_Box, tol ) )
+        {
+            continue;
+        }
+
+        if ( na.m_Count > 0 && nb.m_Count > 0 )
+        {
+            if ( leaf_func( na, nb ) )
+            {
+                return true;
+            }
+        }
+        //==== Descend Into The Larger Interior Node, Nearer Child First ====//
+        else if ( nb.m_Count > 0 || ( na.m_Count == 0 && HalfArea( na.m_Box ) >= HalfArea( nb.m_Box ) ) )
+        {
+            int c0 = na.m_Start;
+            int c1 = na.m_Start + 1;
+            if ( BoxDist2( m_NodeVec[c0].m_Box, nb.m_Box ) > BoxDist2( m_NodeVec[c1].m_Box, nb.m_Box ) )
+            {
+                std::swap( c0, c1 );
+            }
+            pair_stack.push_back( std::make_pair( c1, b ) );
+            pair_stack.push_back( std::make_pair( c0, b ) );
+        }
+        else
+        {
+            int c0 = nb.m_Start;
+            int c1 = nb.m_Start + 1;
+            if ( BoxDist2( na.m_Box, iBvh->m_NodeVec[c0].m_Box ) > BoxDist2( na.m_Box, iBvh->m_NodeVec[c1].m_Box ) )
+            {
+                std::swap( c0, c1 );
+            }
+            pair_stack.push_back( std::make_pair( a, c1 ) );
+            pair_stack.push_back( std::make_pair( a, c0 ) );
+        }
+    }
+    return false;
+}
+
+void TBvh::Intersect( TBvh* iBvh, bool UWFlag )
+{
+    double tol = 1.0e-12;
+
+    TraversePairs( iBvh, tol, [ & ]( const TBvhNode & na, const TBvhNode & nb )
+    {
+        for ( int i = na.m_Start ; i < na.m_Start + na.m_Count ; i++ )
+        {
+            for ( int j = nb.m_Start ; j < nb.m_Start + nb.m_Count ; j++ )
+            {
+                IntersectTris( m_TriVec[i], iBvh->m_TriVec[j], UWFlag, NULL );
+            }
+        }
+        return false;
+    } );
+}
+
+//==== Collect Intersection Edges Without Touching Either Mesh ====//
+void TBvh::Intersect( TBvh* iBvh, vector< std::pair< TTri*, TEdge* > > & isect_vec ) const
+{
+    double tol = 1.0e-12;
+
+    TraversePairs( iBvh, tol, [ & ]( const TBvhNode & na, const TBvhNode & nb )
+    {
+        for ( int i = na.m_Start ; i < na.m_Start + na.m_Count ; i++ )
+        {
+            for ( int j = nb.m_Start ; j < nb.m_Start + nb.m_Count ; j++ )
+            {
+                IntersectTris( m_TriVec[i], iBvh->m_TriVec[j], false, &isect_vec );
+            }
+        }
+        return false;
+    } );
+}
+
+bool TBvh::CheckIntersect( TBvh* iBvh ) const
+{
+    double tol = 1.0e-12;
+
+    return TraversePairs( iBvh, tol, [ & ]( const TBvhNode & na, const TBvhNode & nb )
+    {
+        int coplanarFlag = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
+        vec3d e0;
+        vec3d e1;
+
+        //==== Check All Tris In One Leaf Against The Other ====//
+        for ( int i = na.m_Start ; i < na.m_Start + na.m_Count ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( int j = nb.m_Start ; j < nb.m_Start + nb.m_Count ; j++ )
+            {
+                TTri* t1 = iBvh->m_TriVec[j];
+
+                int iflag = tri_tri_intersection_test_3d(
+                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                &coplanarFlag, e0.v, e1.v );
+
+                if ( iflag && !coplanarFlag )
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    } );
+}
+
+double TBvh::MinDistance( TBvh* iBvh, double curr_min_dist ) const
+{
+    // Boxes farther apart than the running minimum are skipped as it shrinks
+    TraversePairs( iBvh, curr_min_dist, [ & ]( const TBvhNode & na, const TBvhNode & nb )
+    {
+        for ( int i = na.m_Start ; i < na.m_Start + na.m_Count ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( int j = nb.m_Start ; j < nb.m_Start + nb.m_Count ; j++ )
+            {
+                TTri* t1 = iBvh->m_TriVec[j];
+                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt );
+
+                if ( d < curr_min_dist )
+                {
+                    curr_min_dist = d;
+                }
+            }
+        }
+        return false;
+    } );
+
+    return curr_min_dist;
+}
+
+void TBvh::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec ) const
+{
+    if ( IsEmpty() )
+    {
+        return;
+    }
+
+    double coord[3];
+    double tparm, uparm, vparm;
+
+    vector< int > node_stack;
+    node_stack.push_back( 0 );
+
+    while ( !node_stack.empty() )
+    {
+        const TBvhNode & node = m_NodeVec[ node_stack.back() ];
+        node_stack.pop_back();
+
+        if( !intersectRayAABB( node.m_Box.GetMin().v, node.m_Box.GetMax().v, orig.v, dir.v, coord ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Count == 0 )
+        {
+            node_stack.push_back( node.m_Start + 1 );
+            node_stack.push_back( node.m_Start );
+            continue;
+        }
+
+        //==== Check All Tris In Leaf ====//
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            TTri* tri = m_TriVec[i];
+            int iFlag = intersect_triangle( orig.v, dir.v,
+                                            tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+
+            if ( iFlag && tparm > 0.0 )
+            {
+                AddRayHit( tparm, tParmVec );
+            }
+        }
+    }
+}
+
+//==== Cast A Bundle Of Rays With The Same Direction ====//
+// The bundle walks the tree once, each node's box is tested against the rays still
+// active at that node and only the survivors go on to the children.  Every ray visits
+// the same leaves in the same order as RayCast, so tparm_vecs[i] matches RayCast for
+// orig_vec[i] exactly.
+void TBvh::RayCastPacket( vector< vec3d > & orig_vec, vec3d & dir, vector< vector< double > > & tparm_vecs ) const
+{
+    int nray = ( int )orig_vec.size();
+    tparm_vecs.resize( nray );
+    for ( int i = 0 ; i < nray ; i++ )
+    {
+        tparm_vecs[i].clear();
+    }
+
+    if ( IsEmpty() || nray == 0 )
+    {
+        return;
+    }
+
+    double coord[3];
+    double tparm, uparm, vparm;
+
+    //==== Active Ray Lists, Each Stack Entry Owns A Range Of ray_buf ====//
+    struct PacketEntry
+    {
+        int m_Node;
+        int m_Start;
+        int m_Count;
+    };
+
+    vector< int > ray_buf( nray );
+    for ( int i = 0 ; i < nray ; i++ )
+    {
+        ray_buf[i] = i;
+    }
+
+    vector< PacketEntry > node_stack;
+    node_stack.push_back( { 0, 0, nray } );
+
+    while ( !node_stack.empty() )
+    {
+        PacketEntry entry = node_stack.back();
+        node_stack.pop_back();
+
+        //==== Anything Past This Entry's Range Belongs To Finished Subtrees ====//
+        ray_buf.resize( entry.m_Start + entry.m_Count );
+
+        const TBvhNode & node = m_NodeVec[ entry.m_Node ];
+
+        int start = ( int )ray_buf.size();
+        for ( int r = entry.m_Start ; r < entry.m_Start + entry.m_Count ; r++ )
+        {
+            int iray = ray_buf[r];
+            if ( intersectRayAABB( node.m_Box.GetMin().v, node.m_Box.GetMax().v, orig_vec[iray].v, dir.v, coord ) )
+            {
+                ray_buf.push_back( iray );
+            }
+        }
+
+        int count = ( int )ray_buf.size() - start;
+        if ( count == 0 )
+        {
+            continue;
+        }
+
+        if ( node.m_Count == 0 )
+        {
+            node_stack.push_back( { node.m_Start + 1, start, count } );
+            node_stack.push_back( { node.m_Start, start, count } );
+            continue;
+        }
+
+        //==== Check All Tris In Leaf Against The Active Rays ====//
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            TTri* tri = m_TriVec[i];
+            for ( int r = start ; r < start + count ; r++ )
+            {
+                int iray = ray_buf[r];
+                int iFlag = intersect_triangle( orig_vec[iray].v, dir.v,
+                                                tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+
+                if ( iFlag && tparm > 0.0 )
+                {
+                    AddRayHit( tparm, tparm_vecs[iray] );
+                }
+            }
+        }
+    }
+}
+
+//==== Add Ray Hit Unless The Same T Was Already Found ====//
+void TBvh::AddRayHit( double tparm, vector<double> & tParmVec )
+{
+    for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+    {
+        if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+        {
+            return;
+        }
+    }
+    tParmVec.push_back( tparm );
+}
+
 //===============================================//
 //===============================================//
 //===============================================//
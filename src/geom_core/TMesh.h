@@ -365,6 +365,9 @@ private:
 
 };
 
+//==== Oct Tree Of Tris ====//
+// Former TMesh acceleration structure, replaced by TBvh and kept as a reference
+// for GeomCoreTestSuite::TMeshBvhTest.
 class TBndBox
 {
 public:
@@ -388,6 +391,52 @@ public:
 
 };
 
+//==== Bounding Volume Hierarchy Of Tris ====//
+// Binary tree built with the surface area heuristic and stored in flat arrays.
+// Children of an interior node are adjacent in m_NodeVec, the tris of a leaf are
+// adjacent in m_TriVec, and all queries walk the tree with an explicit stack.
+class TBvh
+{
+public:
+    TBvh();
+    virtual ~TBvh();
+
+    void Reset();
+    void Build( const vector< TTri* > & tri_vec );
+
+    bool IsEmpty() const                                            { return m_NodeVec.empty(); }
+    int GetNumNodes() const                                         { return ( int )m_NodeVec.size(); }
+
+    BndBox m_Box;                   // Bounds of all tris
+
+    void Intersect( TBvh* iBvh, bool UWFlag = false );
+    void Intersect( TBvh* iBvh, vector< std::pair< TTri*, TEdge* > > & isect_vec ) const;
+    void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec ) const;
+    void RayCastPacket( vector< vec3d > & orig_vec, vec3d & dir, vector< vector< double > > & tparm_vecs ) const;
+
+    bool CheckIntersect( TBvh* iBvh ) const;
+    double MinDistance( TBvh* iBvh, double curr_min_dist ) const;
+
+protected:
+
+    struct TBvhNode
+    {
+        BndBox m_Box;
+        int m_Start;                // First child for interior nodes, first tri in m_TriVec for leaves
+        int m_Count;                // Number of tris in a leaf, 0 for interior nodes
+    };
+
+    template < typename LeafFunc >
+    bool TraversePairs( const TBvh* iBvh, const double & tol, LeafFunc leaf_func ) const;
+
+    static void AddRayHit( double tparm, vector<double> & tParmVec );
+    static double HalfArea( const BndBox & box );
+    static double BoxDist2( const BndBox & b0, const BndBox & b1 );
+
+    vector< TBvhNode > m_NodeVec;
+    vector< TTri* > m_TriVec;
+};
+
 class Geom;
 
 class TMesh
@@ -400,7 +449,7 @@ public:
     vector< TNode* > m_NVec;
     vector< TEdge* > m_EVec;
 
-    TBndBox m_TBox;
+    TBvh m_TBvh;
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
@@ -437,6 +486,7 @@ public:
     int  RemoveDegenerate();
     void RemoveIsectEdges();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    void Intersect( TMesh* tm, vector< std::pair< TTri*, TEdge* > > & isect_vec );
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
@@ -446,7 +496,7 @@ public:
     void IgnoreYLessThan( const double & ytol );
 
     void DeterIntExt( vector< TMesh* >& meshVec );
-    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void DeterIntExtTris( vector< TTri* > & tri_vec, int istart, int iend, vector< TMesh* >& meshVec );
 
     void LoadBndBox();
 
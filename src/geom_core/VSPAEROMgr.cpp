@@ -109,6 +109,10 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_NumWakeNodes.SetPowShift( 2, 0 ); // Must come before Init
     m_NumWakeNodes.Init( "RootWakeNodes", groupname, this, 64, 0, 10e12 );
     m_NumWakeNodes.SetDescript( "Number of Wake Nodes (f(n^2))" );
+    m_WakeTolerance.Init( "WakeTolerance", groupname, this, 0.0, 0.0, 1.0 );
+    m_WakeTolerance.SetDescript( "Stop the wake iterations once the wake motion and CL, CD changes are below this (0 = Run All Iterations)" );
+    m_WakeAccelerationFlag.Init( "WakeAccelerationFlag", groupname, this, false, false, true );
+    m_WakeAccelerationFlag.SetDescript( "Flag to Anderson accelerate the wake iterations" );
 
     m_BatchModeFlag.Init( "BatchModeFlag", groupname, this, true, false, true );
     m_BatchModeFlag.SetDescript( "Flag to calculate in batch mode" );
@@ -210,6 +214,8 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_GroundEffect.Init( "GroundEffect", groupname, this, -1, -1, 1e6 );
     m_GroundEffect.SetDescript( "Ground Effect Distance" );
     m_GroundEffectToggle.Init( "GroundEffectToggle", groupname, this, false, false, true );
+    m_FarFieldTolerance.Init( "FarFieldTolerance", groupname, this, 1.0, 0.5, 3.0 );
+    m_FarFieldTolerance.SetDescript( "Far Field Agglomeration Tolerance (1 = Full Accuracy, Larger Values Trade Accuracy for Speed)" );
 
     m_ActuatorDiskFlag.Init( "ActuatorDiskFlag", groupname, this, false, false, true );
     m_ActuatorDiskFlag.SetDescript( "Flag for VSPAERO to Analyze Actuator Disks (Disk tab)" );
@@ -355,8 +361,11 @@ void VSPAEROMgrSingleton::Renew()
     m_MaxTurnToggle.Set( false );
     m_FarDistToggle.Set( false );
     m_GroundEffectToggle.Set( false );
+    m_FarFieldTolerance.Set( 1.0 );
     m_FromSteadyState.Set( false );
     m_NumWakeNodes.Set( 64 );
+    m_WakeTolerance.Set( 0.0 );
+    m_WakeAccelerationFlag.Set( false );
 }
 
 xmlNodePtr VSPAEROMgrSingleton::EncodeXml( xmlNodePtr & node )
@@ -1429,6 +1438,11 @@ string VSPAEROMgrSingleton::CreateSetupFile()
         fprintf( case_file, "WakeIters = %d \n", m_WakeNumIter.Get() );
     }
 
+    fprintf( case_file, "WakeTolerance = %lf \n", m_WakeTolerance() );
+    fprintf( case_file, "WakeAcceleration = %d \n", m_WakeAccelerationFlag() );
+
+    fprintf( case_file, "FarFieldTolerance = %lf \n", m_FarFieldTolerance() );
+
     // RotorDisks
     if ( m_ActuatorDiskFlag() )
     {
@@ -4003,6 +4017,10 @@ string VSPAEROMgrSingleton::ExecuteCpSlicer( FILE * logFile )
     //====== Send command to be executed by the system at the command prompt ======//
     vector<string> args;
 
+    // Set number of openmp threads
+    args.push_back( "-omp" );
+    args.push_back( StringUtil::int_to_string( m_NCPU.Get(), "%d" ) );
+
     // Add model file name
     args.push_back( "-slice" );
     args.push_back( m_ModelNameBase );
@@ -395,6 +395,8 @@ public:
     BoolParm m_FixedWakeFlag;
     IntParm m_WakeNumIter;
     PowIntParm m_NumWakeNodes;
+    Parm m_WakeTolerance;
+    BoolParm m_WakeAccelerationFlag;
 
     // Other Setup Parameters
     Parm m_Vinf;
@@ -415,6 +417,7 @@ public:
     Parm m_FarDist;
     BoolParm m_GroundEffectToggle;
     Parm m_GroundEffect;
+    Parm m_FarFieldTolerance;
 
     BoolParm m_RotateBladesFlag;
     BoolParm m_ActuatorDiskFlag;
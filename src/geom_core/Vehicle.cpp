@@ -42,8 +42,13 @@
 
 #include "ProjectionMgr.h"
 
+#include "ParallelUtil.h"
+
 using namespace vsp;
 
+// Set while this thread updates a geom tree already found safe to update concurrently
+static thread_local bool s_InParallelUpdate = false;
+
 //==== Constructor ====//
 Vehicle::Vehicle()
 {
@@ -209,6 +214,8 @@ Vehicle::Vehicle()
     m_STLExportPropMainSurf.Init( "ExportPropMainSurf", "STLSettings", this, false, 0, 1 );
 
     m_UpdatingBBox = false;
+    m_BatchAxisLengthFlag = false;
+
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -467,6 +474,7 @@ void Vehicle::Wype()
     }
 
     m_GeomStoreVec.clear();
+    m_GeomIDMap.clear();
 
     m_ActiveGeom.clear();
     m_TopGeom.clear();
@@ -480,7 +488,10 @@ void Vehicle::Wype()
 
     m_ExportFileNames.clear();
 
+    m_BatchAxisLengthFlag = false;
+
     // Clear out various managers...
+    ParmMgr.ResetBatch();
     LinkMgr.Renew();
     AdvLinkMgr.Renew();
     DesignVarMgr.Renew();
@@ -610,6 +621,16 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
         return;
     }
 
+    //==== Deferred To EndParmBatch ====//
+    if ( ParmMgr.IsBatchOpen() )
+    {
+        if ( parm_ptr == &m_AxisLength )
+        {
+            m_BatchAxisLengthFlag = true;
+        }
+        return;
+    }
+
     m_UpdatingBBox = true;
     UpdateBBox();
     m_UpdatingBBox = false;
@@ -622,6 +643,56 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
     UpdateGui();
 }
 
+//==== Start Parm Batch ====//
+// Until the matching EndParmBatch, parm changes only mark their geoms for a late
+// update and record the linked parms, instead of each one propagating its links
+// and updating the geoms, bounding box and screens.  Batches may be nested.
+void Vehicle::BeginParmBatch()
+{
+    ParmMgr.BeginBatch();
+}
+
+//==== Commit Parm Batch ====//
+void Vehicle::EndParmBatch()
+{
+    if ( !ParmMgr.IsBatchOpen() )
+    {
+        return;
+    }
+
+    if ( ParmMgr.GetBatchDepth() > 1 )
+    {
+        ParmMgr.EndBatch();
+        return;
+    }
+
+    //==== One Link Propagation Per Linked Parm, Geoms Stay Deferred ====//
+    vector< string > parm_vec = ParmMgr.StartBatchCommit();
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        LinkMgr.ParmChanged( parm_vec[i], true );
+    }
+
+    ParmMgr.EndBatch();
+
+    //==== One Update Of Everything Dirtied ====//
+    if ( m_BatchAxisLengthFlag )
+    {
+        m_BatchAxisLengthFlag = false;
+        ForceUpdate( GeomBase::XFORM );
+    }
+    else
+    {
+        Update();
+    }
+
+    m_UpdatingBBox = true;
+    UpdateBBox();
+    m_UpdatingBBox = false;
+
+    UpdateGui();
+}
+
 //==== Update All Screens ====//
 void Vehicle::UpdateGui()
 {
@@ -637,16 +708,165 @@ void Vehicle::UnDo()
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
-    for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
+    vector< Geom* > top_vec = FindGeomVec( m_TopGeom );
+
+    UpdateGeoms( top_vec, fullupdate );
+
+    MeasureMgr.Update();
+}
+
+//==== Update Geoms That Share No Ancestors, Concurrently Where Safe ====//
+// The geoms' trees are independent except through links and the geom types that
+// read or write shared state, see Geom::IsParallelUpdateSafe.  Runs of adjacent
+// safe trees are updated as concurrent tasks, each task doing its whole tree in
+// the usual parent before child order.  An unsafe tree is a barrier: the safe
+// trees before it finish first, and the ones after it start once it is done, so
+// every unsafe tree sees the same state it would in a serial update.
+// Parm changes in a safe tree reach no links, so the tasks only read the link
+// indexes, which LinkMgr and AdvLinkMgr rebuild whenever their links change.
+void Vehicle::UpdateGeoms( const vector< Geom* > & geom_vec, bool fullupdate )
+{
+    if ( geom_vec.size() < 2 || GetFreeWorkerThreads() == 0 )
     {
-        Geom* g_ptr = FindGeom( m_TopGeom[i] );
-        if ( g_ptr )
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
         {
-            g_ptr->Update( fullupdate );
+            geom_vec[i]->Update( fullupdate );
         }
+        return;
     }
 
-    MeasureMgr.Update();
+    //==== Everything Below A Safe Tree Is Safe ====//
+    if ( s_InParallelUpdate )
+    {
+        UpdateGeomsConcurrently( geom_vec, fullupdate );
+        return;
+    }
+
+    std::unordered_set< string > linked_geom_set;
+    FindLinkedGeoms( linked_geom_set );
+
+    vector< Geom* > parallel_vec;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( IsParallelUpdateSafe( geom_vec[i], linked_geom_set ) )
+        {
+            parallel_vec.push_back( geom_vec[i] );
+            continue;
+        }
+
+        //==== Finish The Safe Trees Ahead Of This One, Then Update It Alone ====//
+        UpdateGeomsConcurrently( parallel_vec, fullupdate );
+        parallel_vec.clear();
+
+        geom_vec[i]->Update( fullupdate );
+    }
+
+    UpdateGeomsConcurrently( parallel_vec, fullupdate );
+}
+
+//==== Update Trees That Share No Parms, Links Or Geoms With Each Other ====//
+void Vehicle::UpdateGeomsConcurrently( const vector< Geom* > & geom_vec, bool fullupdate )
+{
+    if ( geom_vec.size() < 2 )
+    {
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+        {
+            geom_vec[i]->Update( fullupdate );
+        }
+        return;
+    }
+
+    //==== Outermost Batch Turns On ParmMgr Map Locking For Its Duration ====//
+    bool outermost = !s_InParallelUpdate;
+    if ( outermost )
+    {
+        ParmMgr.SetConcurrentUpdate( true );
+    }
+
+    ParallelFor( ( int )geom_vec.size(), [ & ]( int i )
+    {
+        bool in_parallel_update = s_InParallelUpdate;
+        s_InParallelUpdate = true;
+
+        geom_vec[i]->Update( fullupdate );
+
+        s_InParallelUpdate = in_parallel_update;
+    } );
+
+    if ( outermost )
+    {
+        ParmMgr.SetConcurrentUpdate( false );
+    }
+}
+
+//==== Find Geoms Owning A Parm That Is Read Or Set By A Link Or Advanced Link ====//
+void Vehicle::FindLinkedGeoms( std::unordered_set< string > & linked_geom_set )
+{
+    vector< string > parm_vec;
+
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* link = LinkMgr.GetLink( i );
+        if ( link )
+        {
+            parm_vec.push_back( link->GetParmA() );
+            parm_vec.push_back( link->GetParmB() );
+        }
+    }
+
+    vector< AdvLink* > adv_link_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_link_vec.size() ; i++ )
+    {
+        vector< VarDef > var_vec = adv_link_vec[i]->GetInputVars();
+        vector< VarDef > out_vec = adv_link_vec[i]->GetOutputVars();
+        var_vec.insert( var_vec.end(), out_vec.begin(), out_vec.end() );
+
+        for ( int j = 0 ; j < ( int )var_vec.size() ; j++ )
+        {
+            parm_vec.push_back( var_vec[j].m_ParmID );
+        }
+    }
+
+    //==== Walk Up From Each Parm's Container (XSec, SubSurf...) To Its Geom ====//
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        Parm* parm_ptr = ParmMgr.FindParm( parm_vec[i] );
+        if ( !parm_ptr )
+        {
+            continue;
+        }
+
+        ParmContainer* pc = parm_ptr->GetContainer();
+        while ( pc )
+        {
+            if ( FindGeom( pc->GetID() ) )
+            {
+                linked_geom_set.insert( pc->GetID() );
+                break;
+            }
+            pc = pc->GetParentContainerPtr();
+        }
+    }
+}
+
+//==== Check If A Geom And All Its Descendants Can Update Concurrently With Other Trees ====//
+bool Vehicle::IsParallelUpdateSafe( Geom* geom_ptr, const std::unordered_set< string > & linked_geom_set )
+{
+    if ( !geom_ptr->IsParallelUpdateSafe() || linked_geom_set.count( geom_ptr->GetID() ) )
+    {
+        return false;
+    }
+
+    vector< Geom* > child_vec = FindGeomVec( geom_ptr->GetChildIDVec() );
+    for ( int i = 0 ; i < ( int )child_vec.size() ; i++ )
+    {
+        if ( !IsParallelUpdateSafe( child_vec[i], linked_geom_set ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 // Update managers that are normally only updated by their 
@@ -699,14 +919,43 @@ Geom* Vehicle::FindGeom( const string & geom_id )
     {
         return NULL;
     }
+
+    unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( geom_id );
+    if ( iter != m_GeomIDMap.end() )
+    {
+        return iter->second;
+    }
+    return NULL;
+}
+
+//==== Move A Stored Geom To Its New ID In The ID Map, Called From Geom::ChangeID ====//
+void Vehicle::ChangeGeomID( const string & old_id, Geom* geom_ptr )
+{
+    unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( old_id );
+    if ( iter != m_GeomIDMap.end() && iter->second == geom_ptr )
+    {
+        m_GeomIDMap.erase( iter );
+        m_GeomIDMap[ geom_ptr->GetID() ] = geom_ptr;
+    }
+}
+
+//==== Check The ID Map Holds Exactly The Stored Geoms Under Their Current IDs ====//
+bool Vehicle::CheckGeomIDMap()
+{
+    if ( m_GeomIDMap.size() != m_GeomStoreVec.size() )
+    {
+        return false;
+    }
+
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
     {
-        if ( m_GeomStoreVec[i]->IsMatch( geom_id ) )
+        unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( m_GeomStoreVec[i]->GetID() );
+        if ( iter == m_GeomIDMap.end() || iter->second != m_GeomStoreVec[i] )
         {
-            return m_GeomStoreVec[i];
+            return false;
         }
     }
-    return NULL;
+    return true;
 }
 
 //==== Find Vector of Geom Ptrs Based on GeomID ====//
@@ -798,6 +1047,7 @@ string Vehicle::CreateGeom( const GeomType & type )
     }
 
     m_GeomStoreVec.push_back( new_geom );
+    m_GeomIDMap[ new_geom->GetID() ] = new_geom;
 
     Geom* type_geom_ptr = FindGeom( type.m_GeomID );
     if ( type_geom_ptr )
@@ -1309,6 +1559,7 @@ void Vehicle::DeleteClipBoard()
         if ( gPtr )
         {
             vector_remove_val( m_GeomStoreVec, gPtr );
+            m_GeomIDMap.erase( gPtr->GetID() );
             delete gPtr;
         }
     }
@@ -1321,6 +1572,7 @@ void Vehicle::DeleteGeom( const string & geom_id )
     if ( gPtr )
     {
         vector_remove_val( m_GeomStoreVec, gPtr );
+        m_GeomIDMap.erase( gPtr->GetID() );
         vector_remove_val( m_ActiveGeom, geom_id );
         delete gPtr;
     }
@@ -1740,6 +1992,7 @@ void Vehicle::DeleteType( int index )
     if ( gPtr )
     {
         vector_remove_val( m_GeomStoreVec, gPtr );
+        m_GeomIDMap.erase( gPtr->GetID() );
         delete gPtr;
     }
 
@@ -36,6 +36,8 @@
 #include <deque>
 #include <stack>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 // File versions must be integers.
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
@@ -69,7 +71,11 @@ public:
     void ParmChanged( Parm* parm_ptr, int type );
     static void UnDo();
 
+    static void BeginParmBatch();
+    void EndParmBatch();
+
     void Update( bool fullupdate = true );
+    void UpdateGeoms( const vector< Geom* > & geom_vec, bool fullupdate );
     void UpdateManagers();
     void UpdateGeom( const string &geom_id );
     void ForceUpdate( int dirtyflag = GeomBase::NONE );
@@ -78,6 +84,8 @@ public:
 
     Geom* FindGeom( const string & geom_id );
     vector< Geom* > FindGeomVec( const vector< string > & geom_id_vec );
+    void ChangeGeomID( const string & old_id, Geom* geom_ptr );
+    bool CheckGeomIDMap();
 
     string CreateGeom( const GeomType & type );
     string AddGeom( const GeomType & type );
@@ -501,6 +509,7 @@ protected:
     virtual void SetExportPropMainSurf( bool b );
 
     vector< Geom* > m_GeomStoreVec;                 // All Geom Ptrs
+    std::unordered_map< string, Geom* > m_GeomIDMap;    // ID->Geom Map of m_GeomStoreVec
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
@@ -516,8 +525,14 @@ protected:
     vector< GeomType > m_GeomTypeVec;
 
     bool m_UpdatingBBox;
+    bool m_BatchAxisLengthFlag;                 // Axis length changed during parm batch
     BndBox m_BBox;                              // Bounding Box Around All Geometries
 
+
+    void UpdateGeomsConcurrently( const vector< Geom* > & geom_vec, bool fullupdate );
+    void FindLinkedGeoms( std::unordered_set< string > & linked_geom_set );
+    bool IsParallelUpdateSafe( Geom* geom_ptr, const std::unordered_set< string > & linked_geom_set );
+
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
     //==== Primary file name ====//
@@ -312,7 +312,7 @@ VSPAEROScreen::VSPAEROScreen( ScreenMgr* mgr ) : TabScreen( mgr, VSPAERO_SCREEN_
     // Wake Layout
     m_AdvancedLeftLayout.AddSubGroupLayout( m_WakeLayout,
         m_AdvancedLeftLayout.GetW(),
-        4 * m_AdvancedLeftLayout.GetStdHeight() );
+        6 * m_AdvancedLeftLayout.GetStdHeight() );
     m_AdvancedLeftLayout.AddY( m_WakeLayout.GetH() );
 
     m_WakeLayout.AddDividerBox( "Wake" );
@@ -323,6 +323,8 @@ VSPAEROScreen::VSPAEROScreen( ScreenMgr* mgr ) : TabScreen( mgr, VSPAERO_SCREEN_
 
     m_WakeLayout.AddSlider( m_WakeNumIterSlider, "Num It.", 10, "%3.0f" );
     m_WakeLayout.AddSlider( m_NumWakeNodeSlider, "Wake Nodes", 128, "%3.0f" );
+    m_WakeLayout.AddSlider( m_WakeToleranceSlider, "Tolerance", 0.01, "%7.5f" );
+    m_WakeLayout.AddButton( m_WakeAccelerationToggle, "Accelerate Wake Iterations" );
 
     // Other Setup Parms Layout
     m_AdvancedLeftLayout.AddSubGroupLayout( m_OtherParmsLayout,
@@ -362,6 +364,10 @@ VSPAEROScreen::VSPAEROScreen( ScreenMgr* mgr ) : TabScreen( mgr, VSPAERO_SCREEN_
     m_OtherParmsLayout.SetButtonWidth( labelwidth );
     m_OtherParmsLayout.AddSlider( m_GroundEffectSlider, "Ground Effect Dist", 1e3, "%7.2f" );
     m_OtherParmsLayout.ForceNewLine();
+    m_OtherParmsLayout.SetSameLineFlag( false );
+    m_OtherParmsLayout.SetFitWidthFlag( true );
+    m_OtherParmsLayout.SetButtonWidth( labelwidth + togglewidth );
+    m_OtherParmsLayout.AddSlider( m_FarFieldTolSlider, "Far Field Tolerance", 1, "%3.2f" );
     m_OtherParmsLayout.AddYGap();
 
     // Propeller and Stability Setup
@@ -1416,6 +1422,8 @@ void VSPAEROScreen::UpdateAdvancedTabDevices()
     m_FixedWakeToggle.Update( VSPAEROMgr.m_FixedWakeFlag.GetID() );
     m_WakeNumIterSlider.Update(VSPAEROMgr.m_WakeNumIter.GetID());
     m_NumWakeNodeSlider.Update( VSPAEROMgr.m_NumWakeNodes.GetID() );
+    m_WakeToleranceSlider.Update( VSPAEROMgr.m_WakeTolerance.GetID() );
+    m_WakeAccelerationToggle.Update( VSPAEROMgr.m_WakeAccelerationFlag.GetID() );
 
     bool time_dependent = false;
     if ( VSPAEROMgr.m_RotateBladesFlag() || VSPAEROMgr.m_StabilityType() == vsp::STABILITY_P_ANALYSIS ||
@@ -1436,10 +1444,14 @@ void VSPAEROScreen::UpdateAdvancedTabDevices()
     if ( time_dependent || VSPAEROMgr.m_FixedWakeFlag() )
     {
         m_WakeNumIterSlider.Deactivate();
+        m_WakeToleranceSlider.Deactivate();
+        m_WakeAccelerationToggle.Deactivate();
     }
     else
     {
         m_WakeNumIterSlider.Activate();
+        m_WakeToleranceSlider.Activate();
+        m_WakeAccelerationToggle.Activate();
     }
 
     // Other Set Up Parms
@@ -1451,6 +1463,7 @@ void VSPAEROScreen::UpdateAdvancedTabDevices()
     m_FarDistSlider.Update( VSPAEROMgr.m_FarDist.GetID() );
     m_GroundEffectToggle.Update( VSPAEROMgr.m_GroundEffectToggle.GetID() );
     m_GroundEffectSlider.Update( VSPAEROMgr.m_GroundEffect.GetID() );
+    m_FarFieldTolSlider.Update( VSPAEROMgr.m_FarFieldTolerance.GetID() );
 
     // Stability
     if (VSPAEROMgr.m_Symmetry())
@@ -195,6 +195,8 @@ protected:
     ToggleButton m_FixedWakeToggle;
     SliderAdjRangeInput m_WakeNumIterSlider;
     SliderAdjRangeInput m_NumWakeNodeSlider;
+    ToggleButton m_WakeAccelerationToggle;
+    SliderAdjRangeInput m_WakeToleranceSlider;
 
     // Other Setup Parms Setup
     Choice m_ClmaxChoice;
@@ -205,6 +207,7 @@ protected:
     SliderAdjRangeInput m_MaxTurningSlider;
     SliderAdjRangeInput m_FarDistSlider;
     SliderAdjRangeInput m_GroundEffectSlider;
+    SliderAdjRangeInput m_FarFieldTolSlider;
 
     ToggleButton m_ActuatorDiskToggle;
     ToggleButton m_RotateBladesToggle;
@@ -31,12 +31,15 @@ double Cubic_Stretch( const double &t, const double &ds0, const double &ds1 )
 //
 double HypTan_Stretch( const double &t, const double &ds0, const double &ds1 )
 {
-    static double d0 = -1;
-    static double d1 = -1;
-    static double a = -1;
-    static double b = -1;
-    static double hdelta = -1;
-    static double tnh2 = -1;
+    // Cached between calls, per thread since geoms may be updated concurrently.  Each
+    // ParallelFor starts fresh workers, so a worker's cache only lives for its share of
+    // one loop, which is where the repeated calls with the same spacings come from.
+    static thread_local double d0 = -1;
+    static thread_local double d1 = -1;
+    static thread_local double a = -1;
+    static thread_local double b = -1;
+    static thread_local double hdelta = -1;
+    static thread_local double tnh2 = -1;
 
     if ( d0 != ds0 || d1 != ds1 )
     {
@@ -120,8 +123,8 @@ double asinhc_approx( const double &y )
 //
 double asinhc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
+    static thread_local double lasty = -1.0; // Negative argument impossible
+    static thread_local double lastx = 0;
 
     if ( y == lasty )
     {
@@ -207,8 +210,8 @@ double asinc_approx( const double &y )
 //
 double asinc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
+    static thread_local double lasty = -1.0; // Negative argument impossible
+    static thread_local double lastx = 0;
 
     if ( y == lasty )
     {
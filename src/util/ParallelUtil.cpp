@@ -0,0 +1,83 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "ParallelUtil.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// The calling thread does its share of the work, so one less worker
+static std::atomic< int > s_WorkerThreadsFree( std::max( ( int )std::thread::hardware_concurrency() - 1, 0 ) );
+
+//==== Take Up To num_wanted Workers From The Budget ====//
+int ClaimWorkerThreads( int num_wanted )
+{
+    int free_threads = s_WorkerThreadsFree;
+
+    while ( num_wanted > 0 && free_threads > 0 )
+    {
+        int num = std::min( num_wanted, free_threads );
+        if ( s_WorkerThreadsFree.compare_exchange_weak( free_threads, free_threads - num ) )
+        {
+            return num;
+        }
+    }
+    return 0;
+}
+
+//==== Give Workers Back ====//
+void ReleaseWorkerThreads( int num )
+{
+    s_WorkerThreadsFree += num;
+}
+
+int GetFreeWorkerThreads()
+{
+    return s_WorkerThreadsFree;
+}
+
+//==== Parallel Loop Over Independent Items ====//
+void ParallelFor( int n, const std::function< void( int ) > & func )
+{
+    int num_threads = ClaimWorkerThreads( n - 1 );
+
+    if ( num_threads == 0 )
+    {
+        for ( int i = 0 ; i < n ; i++ )
+        {
+            func( i );
+        }
+        return;
+    }
+
+    //==== Workers And This Thread Take Items Until None Are Left ====//
+    std::atomic< int > next_item( 0 );
+
+    auto run_items = [ & ]()
+    {
+        int i;
+        while ( ( i = next_item++ ) < n )
+        {
+            func( i );
+        }
+    };
+
+    std::vector< std::thread > thread_vec;
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        thread_vec.push_back( std::thread( run_items ) );
+    }
+
+    run_items();
+
+    for ( int t = 0 ; t < num_threads ; t++ )
+    {
+        thread_vec[t].join();
+    }
+
+    ReleaseWorkerThreads( num_threads );
+}
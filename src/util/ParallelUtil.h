@@ -0,0 +1,24 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#if !defined(VSP_PARALLEL_UTIL__INCLUDED_)
+#define VSP_PARALLEL_UTIL__INCLUDED_
+
+#include <functional>
+
+//==== Worker Thread Budget ====//
+// One budget of hardware_concurrency() - 1 worker threads is shared by everything
+// that runs concurrently (geom updates, tessellation...), so nested concurrent work
+// gets whatever workers are free and otherwise runs on the calling thread.
+int ClaimWorkerThreads( int num_wanted );
+void ReleaseWorkerThreads( int num );
+int GetFreeWorkerThreads();
+
+//==== Run func( i ) For i = 0 ... n - 1 Using Free Workers And The Calling Thread ====//
+// Items are independent: func( i ) may only write results belonging to item i.
+// Runs in order on the calling thread when there is nothing to share.
+void ParallelFor( int n, const std::function< void( int ) > & func );
+
+#endif // !defined(VSP_PARALLEL_UTIL__INCLUDED_)
@@ -10,49 +10,100 @@
 
 #include "SimpleTess.h"
 
+#include <algorithm>
+
 SimpleTess::SimpleTess()
 {
     m_FlipNormal = false;
+    m_nufeat = 0;
+    m_nvfeat = 0;
 }
 
 SimpleTess::~SimpleTess()
 {
 }
 
-void SimpleTess::Transform( const Matrix4d & mat )
+void SimpleTess::Clear()
 {
-    // Transform points
-    for ( int i = 0; i < m_pnts.size(); i++ )
+    m_Offset.clear();
+    m_NU.clear();
+    m_NV.clear();
+
+    m_PntBuf.clear();
+    m_NormBuf.clear();
+    m_UTexBuf.clear();
+    m_VTexBuf.clear();
+}
+
+// Append an nu x nv patch, returns its index.  Texture coordinates are dropped
+// until the next CalcTexCoords.
+int SimpleTess::AddPatch( int nu, int nv )
+{
+    int offset = ( int )m_PntBuf.size();
+
+    m_Offset.push_back( offset );
+    m_NU.push_back( nu );
+    m_NV.push_back( nv );
+
+    m_PntBuf.resize( offset + nu * nv );
+    m_NormBuf.resize( offset + nu * nv );
+
+    m_UTexBuf.clear();
+    m_VTexBuf.clear();
+
+    return ( int )m_NU.size() - 1;
+}
+
+// Pack patches from VspSurf::SplitTesselate.
+void SimpleTess::SetPatches( const vector< vector< vector< vec3d > > > & pnts, const vector< vector< vector< vec3d > > > & norms )
+{
+    Clear();
+
+    int npatch = ( int )pnts.size();
+    m_Offset.resize( npatch );
+    m_NU.resize( npatch );
+    m_NV.resize( npatch );
+
+    int ntot = 0;
+    for ( int k = 0; k < npatch; k++ )
     {
-        for ( int j = 0; j < m_pnts[i].size(); j++ )
-        {
-            mat.xformvec( m_pnts[i][j] );
-        }
+        m_Offset[k] = ntot;
+        m_NU[k] = ( int )pnts[k].size();
+        m_NV[k] = pnts[k].empty() ? 0 : ( int )pnts[k][0].size();
+        ntot += m_NU[k] * m_NV[k];
     }
 
-    // Transform normal vectors
-    for ( int i = 0; i < m_norms.size(); i++ )
+    m_PntBuf.resize( ntot );
+    m_NormBuf.resize( ntot );
+
+    for ( int k = 0; k < npatch; k++ )
     {
-        for ( int j = 0; j < m_norms[i].size(); j++ )
+        int indx = m_Offset[k];
+        for ( int i = 0; i < m_NU[k]; i++ )
         {
-            mat.xformnormvec( m_norms[i][j] );
+            std::copy( pnts[k][i].begin(), pnts[k][i].begin() + m_NV[k], m_PntBuf.begin() + indx );
+            std::copy( norms[k][i].begin(), norms[k][i].begin() + m_NV[k], m_NormBuf.begin() + indx );
+            indx += m_NV[k];
         }
     }
 }
 
+void SimpleTess::Transform( const Matrix4d & mat )
+{
+    // Transform points
+    mat.xformvec( m_PntBuf );
+
+    // Transform normal vectors
+    mat.xformnormvec( m_NormBuf );
+}
+
 void SimpleTess::GetBoundingBox( BndBox &bb ) const
 {
     bb.Reset();
 
-    for ( int i = 0; i < m_pnts.size(); i++ )
+    for ( int i = 0; i < ( int )m_PntBuf.size(); i++ )
     {
-        for ( int j = 0; j < m_pnts[i].size(); j++ )
-        {
-            for ( int k = 0; k < m_pnts[i][j].size(); k++ )
-            {
-                bb.Update( m_pnts[i][j][k] );
-            }
-        }
+        bb.Update( m_PntBuf[i] );
     }
 }
 
@@ -63,78 +114,76 @@ void SimpleTess::CalcTexCoords( )
 
     unsigned int n = nu * nv;
 
-    if ( m_pnts.size() != n )
+    if ( m_NU.size() != n )
     {
-        m_utex.clear();
-        m_vtex.clear();
+        m_UTexBuf.clear();
+        m_VTexBuf.clear();
         return;
     }
 
-    m_utex.resize(n);
-    m_vtex.resize(n);
+    m_UTexBuf.resize( m_PntBuf.size() );
+    m_VTexBuf.resize( m_PntBuf.size() );
 
     int k = 0;
     for ( int i = 0; i < nu; i++ )
     {
-
         for ( int j = 0; j < nv; j++ )
         {
-            unsigned int nui = m_pnts[k].size();
+            int nui = m_NU[k];
+            int nvj = m_NV[k];
+
+            double* utex = &m_UTexBuf[ m_Offset[k] ];
+            double* vtex = &m_VTexBuf[ m_Offset[k] ];
+            const vec3d* pnts = &m_PntBuf[ m_Offset[k] ];
 
-            m_utex[k].resize(nui);
-            m_vtex[k].resize(nui);
             for ( int ii = 0; ii < nui; ii++ )
             {
-                unsigned int nvj = m_pnts[k][0].size();
-
-                m_utex[k][ii].resize(nvj);
-                m_vtex[k][ii].resize(nvj);
-
-
                 for ( int jj = 0; jj < nvj; jj++ )
                 {
+                    int indx = ii * nvj + jj;
+
                     if ( ii == 0 )
                     {
                         if ( i == 0 )
                         {
-                            m_utex[k][ii][jj] = 0.0;
+                            utex[ indx ] = 0.0;
                         }
                         else
                         {
-                            int ilast = m_utex[(i-1)*nv+j].size() - 1;
-                            m_utex[k][ii][jj] = m_utex[(i-1)*nv+j][ilast][jj]; // previous kpatch iend;
+                            int kprev = ( i - 1 ) * nv + j;
+                            utex[ indx ] = UTex( kprev, m_NU[ kprev ] - 1, jj ); // previous kpatch iend;
                         }
                     }
                     else
                     {
-                        double du = dist( m_pnts[k][ii][jj], m_pnts[k][ii-1][jj] );
+                        double du = dist( pnts[ indx ], pnts[ indx - nvj ] );
                         if ( du < 1e-6 )
                         {
                             du = 1.0;
                         }
-                        m_utex[k][ii][jj] = m_utex[k][ii-1][jj] + du;
+                        utex[ indx ] = utex[ indx - nvj ] + du;
                     }
 
                     if ( jj == 0 )
                     {
                         if ( j == 0 )
                         {
-                            m_vtex[k][ii][jj] = 0.0;
+                            vtex[ indx ] = 0.0;
                         }
                         else
                         {
-                            int jlast = m_vtex[i*nv+j-1][ii].size() - 1;
-                            m_vtex[k][ii][jj] = m_vtex[i*nv+j-1][ii][jlast]; // previous kpatch jend;
+                            int kprev = i * nv + j - 1;
+                            vtex[ indx ] = VTex( kprev, ii, m_NV[ kprev ] - 1 ); // previous kpatch jend;
                         }
                     }
                     else
                     {
-                        double dv = dist( m_pnts[k][ii][jj], m_pnts[k][ii][jj-1] );
+                        double dv = dist( pnts[ indx ], pnts[ indx - 1 ] );
                         if ( dv < 1e-6 )
                         {
                             dv = 1.0;
                         }
-                        m_vtex[k][ii][jj] = m_vtex[k][ii][jj-1] + dv;
+                        vtex[ indx ] = vtex[ indx - 1 ] + dv;
                     }
                 }
             }
@@ -142,30 +191,105 @@ void SimpleTess::CalcTexCoords( )
         }
     }
 
+    // Normalize by the running totals at the far patches.  Those patches come last in
+    // their row or column, so they are divided after every patch that refers to them.
     k = 0;
     for ( int i = 0; i < nu; i++ )
     {
         for ( int j = 0; j < nv; j++ )
         {
-            int nui = m_pnts[k].size();
+            int kjlast = i * nv + nv - 1;
+            int kilast = ( nu - 1 ) * nv + j;
 
-            for ( int ii = 0; ii < nui; ii++ )
-            {
-                int nvj = m_pnts[k][0].size();
+            int imax = m_NU[ kilast ] - 1;
+            int jmax = m_NV[ kjlast ] - 1;
 
-                for ( int jj = 0; jj < nvj; jj++ )
+            for ( int ii = 0; ii < m_NU[k]; ii++ )
+            {
+                for ( int jj = 0; jj < m_NV[k]; jj++ )
                 {
-                    int kjlast = i*nv+nv-1;
-                    int kilast = (nu-1)*nv+j;
-
-                    int imax = m_utex[kilast].size()-1;
-                    int jmax = m_vtex[kjlast][0].size()-1;
+                    int indx = m_Offset[k] + ii * m_NV[k] + jj;
 
-                    m_utex[k][ii][jj] /= m_utex[kilast][imax][jj];
-                    m_vtex[k][ii][jj] /= m_vtex[kjlast][ii][jmax];
+                    m_UTexBuf[ indx ] /= UTex( kilast, imax, jj );
+                    m_VTexBuf[ indx ] /= VTex( kjlast, ii, jmax );
                 }
             }
             k++;
         }
     }
 }
+
+void SimpleTess::AppendPnts( vector< vector< vector< vec3d > > > & mesh ) const
+{
+    AppendNested( m_PntBuf, mesh );
+}
+
+void SimpleTess::AppendPnts( vector< vector< vector< vec3d > > > & mesh, const Matrix4d & mat ) const
+{
+    int istart = ( int )mesh.size();
+    AppendNested( m_PntBuf, mesh );
+
+    for ( int k = istart; k < ( int )mesh.size(); k++ )
+    {
+        for ( int i = 0; i < ( int )mesh[k].size(); i++ )
+        {
+            mat.xformvec( mesh[k][i] );
+        }
+    }
+}
+
+void SimpleTess::AppendNorms( vector< vector< vector< vec3d > > > & mesh ) const
+{
+    AppendNested( m_NormBuf, mesh );
+}
+
+void SimpleTess::AppendNorms( vector< vector< vector< vec3d > > > & mesh, const Matrix4d & mat ) const
+{
+    int istart = ( int )mesh.size();
+    AppendNested( m_NormBuf, mesh );
+
+    for ( int k = istart; k < ( int )mesh.size(); k++ )
+    {
+        for ( int i = 0; i < ( int )mesh[k].size(); i++ )
+        {
+            mat.xformnormvec( mesh[k][i] );
+        }
+    }
+}
+
+void SimpleTess::AppendUTex( vector< vector< vector< double > > > & mesh ) const
+{
+    AppendNested( m_UTexBuf, mesh );
+}
+
+void SimpleTess::AppendVTex( vector< vector< vector< double > > > & mesh ) const
+{
+    AppendNested( m_VTexBuf, mesh );
+}
+
+// Append one nested patch per patch, nothing if buf is not populated.
+template < typename T >
+void SimpleTess::AppendNested( const vector< T > & buf, vector< vector< vector< T > > > & mesh ) const
+{
+    if ( buf.size() != m_PntBuf.size() || buf.empty() )
+    {
+        return;
+    }
+
+    int npatch = ( int )m_NU.size();
+    int istart = ( int )mesh.size();
+    mesh.resize( istart + npatch );
+
+    for ( int k = 0; k < npatch; k++ )
+    {
+        vector< vector< T > > & patch = mesh[ istart + k ];
+        patch.resize( m_NU[k] );
+
+        typename vector< T >::const_iterator it = buf.begin() + m_Offset[k];
+        for ( int i = 0; i < m_NU[k]; i++ )
+        {
+            patch[i].assign( it, it + m_NV[k] );
+            it += m_NV[k];
+        }
+    }
+}
@@ -8,6 +8,61 @@ using std::vector;
 #include "Matrix4d.h"
 #include "BndBox.h"
 
+//==== Nested View Of Flat Tessellation Data ====//
+// Indexes a SimpleTess attribute buffer as [patch][i][j] so code written against
+// the old vector< vector< vector< T > > > members keeps working.  Views point into
+// the owning SimpleTess and are invalidated when its layout changes.
+template < typename T >
+class TessView
+{
+public:
+
+    class Row
+    {
+    public:
+        Row( T* data, int n ) : m_Data( data ), m_N( n )           {}
+
+        T & operator[]( int j ) const                               { return m_Data[ j ]; }
+        unsigned int size() const                                   { return m_N; }
+        T* begin() const                                            { return m_Data; }
+        T* end() const                                              { return m_Data + m_N; }
+
+    protected:
+        T* m_Data;
+        int m_N;
+    };
+
+    class Patch
+    {
+    public:
+        Patch( T* data, int nu, int nv ) : m_Data( data ), m_NU( nu ), m_NV( nv )      {}
+
+        Row operator[]( int i ) const                               { return Row( m_Data + i * m_NV, m_NV ); }
+        unsigned int size() const                                   { return m_NU; }
+
+    protected:
+        T* m_Data;
+        int m_NU;
+        int m_NV;
+    };
+
+    TessView( T* data, const vector< int > & offset, const vector< int > & nu, const vector< int > & nv ) :
+        m_Data( data ), m_Offset( offset ), m_NU( nu ), m_NV( nv )  {}
+
+    Patch operator[]( int k ) const                                 { return Patch( m_Data + m_Offset[k], m_NU[k], m_NV[k] ); }
+    unsigned int size() const                                       { return m_NU.size(); }
+
+protected:
+    T* m_Data;
+    const vector< int > & m_Offset;
+    const vector< int > & m_NU;
+    const vector< int > & m_NV;
+};
+
+//==== Simple Tessellation ====//
+// Patches of structured grids.  Each attribute is held in one contiguous buffer,
+// patch k starts at GetOffset( k ) and stores its GetNumU( k ) x GetNumV( k ) grid
+// row major, so point ( k, i, j ) is at GetOffset( k ) + i * GetNumV( k ) + j.
 class SimpleTess
 {
 public:
@@ -24,16 +79,76 @@ public:
 
     void CalcTexCoords();
 
+    //==== Patch Layout ====//
+    void Clear();
+    int AddPatch( int nu, int nv );
+    void SetPatches( const vector< vector< vector< vec3d > > > & pnts, const vector< vector< vector< vec3d > > > & norms );
+
+    int GetNumPatches() const                                       { return ( int )m_NU.size(); }
+    int GetNumU( int k ) const                                      { return m_NU[k]; }
+    int GetNumV( int k ) const                                      { return m_NV[k]; }
+    int GetOffset( int k ) const                                    { return m_Offset[k]; }
+    int GetNumPnts() const                                          { return ( int )m_PntBuf.size(); }
+    bool HasTexCoords() const                                       { return !m_UTexBuf.empty(); }
+
+    //==== Flat Access ====//
+    vec3d & Pnt( int k, int i, int j )                              { return m_PntBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+    const vec3d & Pnt( int k, int i, int j ) const                  { return m_PntBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+    vec3d & Norm( int k, int i, int j )                             { return m_NormBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+    const vec3d & Norm( int k, int i, int j ) const                 { return m_NormBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+    double UTex( int k, int i, int j ) const                        { return m_UTexBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+    double VTex( int k, int i, int j ) const                        { return m_VTexBuf[ m_Offset[k] + i * m_NV[k] + j ]; }
+
+    const vector< vec3d > & GetPntBuf() const                       { return m_PntBuf; }
+    const vector< vec3d > & GetNormBuf() const                      { return m_NormBuf; }
+
+    //==== Nested Views ====//
+    TessView< vec3d > GetPnts()                                     { return TessView< vec3d >( m_PntBuf.data(), m_Offset, m_NU, m_NV ); }
+    TessView< const vec3d > GetPnts() const                         { return TessView< const vec3d >( m_PntBuf.data(), m_Offset, m_NU, m_NV ); }
+    TessView< vec3d > GetNorms()                                    { return TessView< vec3d >( m_NormBuf.data(), m_Offset, m_NU, m_NV ); }
+    TessView< const vec3d > GetNorms() const                        { return TessView< const vec3d >( m_NormBuf.data(), m_Offset, m_NU, m_NV ); }
+    TessView< const double > GetUTex() const                        { return TessView< const double >( m_UTexBuf.data(), m_Offset, m_NU, m_NV ); }
+    TessView< const double > GetVTex() const                        { return TessView< const double >( m_VTexBuf.data(), m_Offset, m_NU, m_NV ); }
+
+    //==== Nested Copies For Consumers That Still Need Them ====//
+    void AppendPnts( vector< vector< vector< vec3d > > > & mesh ) const;
+    void AppendPnts( vector< vector< vector< vec3d > > > & mesh, const Matrix4d & mat ) const;
+    void AppendNorms( vector< vector< vector< vec3d > > > & mesh ) const;
+    void AppendNorms( vector< vector< vector< vec3d > > > & mesh, const Matrix4d & mat ) const;
+    void AppendUTex( vector< vector< vector< double > > > & mesh ) const;
+    void AppendVTex( vector< vector< vector< double > > > & mesh ) const;
+
     bool m_FlipNormal;
 
     int m_nufeat;
     int m_nvfeat;
 
-    vector< vector< vector< vec3d > > > m_pnts;
-    vector< vector< vector< vec3d > > > m_norms;
+protected:
+
+    template < typename T >
+    void AppendNested( const vector< T > & buf, vector< vector< vector< T > > > & mesh ) const;
+
+    vector< int > m_Offset;
+    vector< int > m_NU;
+    vector< int > m_NV;
 
-    vector< vector< vector< double > > > m_utex;
-    vector< vector< vector< double > > > m_vtex;
+    vector< vec3d > m_PntBuf;
+    vector< vec3d > m_NormBuf;
+
+    vector< double > m_UTexBuf;
+    vector< double > m_VTexBuf;
+};
+
+//==== Placed Copy Of A Tessellation ====//
+// Symmetric and pattern copies refer to the main tessellation they were made from
+// and are transformed when they are consumed instead of being stored transformed.
+struct TessInstance
+{
+    TessInstance() : m_MainIndx( 0 ), m_FlipNormal( false )       {}
+
+    int m_MainIndx;
+    Matrix4d m_Mat;
+    bool m_FlipNormal;
 };
 
-#endif // SIMPLETESS_H
\ No newline at end of file
+#endif // SIMPLETESS_H
@@ -10,6 +10,8 @@
 #include <deque>
 #include <map>
 #include <algorithm>
+#include <cstring>
+#include <cstdint>
 using std::vector;
 using std::deque;
 
@@ -138,4 +140,27 @@ int sgn( T val )
     return ( T( 0 ) < val ) - ( val < T( 0 ) );
 }
 
+//==== Combine Exact Bits Of Value Into Hash Seed ====//
+inline void hash_combine( std::size_t & seed, double val )
+{
+    uint64_t bits;
+    memcpy( &bits, &val, sizeof( bits ) );
+
+    // Mix bits so nearby values spread over the whole hash
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+
+    seed ^= ( std::size_t )bits + ( std::size_t )0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+}
+
+inline void hash_combine( std::size_t & seed, const vector< double > & vals )
+{
+    hash_combine( seed, ( double )vals.size() );
+    for ( int i = 0 ; i < ( int )vals.size() ; i++ )
+    {
+        hash_combine( seed, vals[i] );
+    }
+}
+
 #endif
@@ -20,6 +20,7 @@
 #include "PntNodeMerge.h"
 #include "Cluster.h"
 #include "VspUtil.h"
+#include "ParallelUtil.h"
 
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
 #include "eli/geom/surface/piecewise_multicap_surface_creator.hpp"
@@ -67,6 +68,9 @@ VspSurf::VspSurf()
     m_LECluster = 1.0;
     m_TECluster = 1.0;
     m_SkinClosedFlag = 0;
+
+    m_ReuseTessKey = 0;
+    m_LastTessKey = 0;
 }
 
 //===== Destructor  =====//
@@ -1554,9 +1558,75 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
     MakeVTess( num_v, v, n_cap, false );
     MakeUTess( num_u, u, umerge );
 
+    //==== Skip Evaluation If Caller Already Holds This Tessellation ====//
+    std::size_t key = GetContentHash();
+    hash_combine( key, u );
+    hash_combine( key, v );
+    if ( key == 0 )
+    {
+        key = 1;
+    }
+
+    bool reuse = ( key == m_ReuseTessKey );
+    m_ReuseTessKey = 0;
+    m_LastTessKey = key;
+
+    if ( reuse )
+    {
+        return;
+    }
+
     SplitTesselate( m_UFeature, m_WFeature, u, v, pnts, norms );
 }
 
+//==== Hash Of Control Net, Parameterization, Features And Normal Direction ====//
+std::size_t VspSurf::GetContentHash() const
+{
+    std::size_t seed = 0;
+
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    hash_combine( seed, ( double )nupatch );
+    hash_combine( seed, ( double )nvpatch );
+
+    vector < double > pmap;
+    m_Surface.get_pmap_u( pmap );
+    hash_combine( seed, pmap );
+    m_Surface.get_pmap_v( pmap );
+    hash_combine( seed, pmap );
+
+    for ( ip = 0; ip < nupatch; ++ip )
+    {
+        for ( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            hash_combine( seed, ( double )patch->degree_u() );
+            hash_combine( seed, ( double )patch->degree_v() );
+
+            for ( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for ( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_patch_type::point_type cp = patch->get_control_point( icp, jcp );
+                    hash_combine( seed, cp.x() );
+                    hash_combine( seed, cp.y() );
+                    hash_combine( seed, cp.z() );
+                }
+            }
+        }
+    }
+
+    hash_combine( seed, m_UFeature );
+    hash_combine( seed, m_WFeature );
+    hash_combine( seed, m_FlipNormal ? 1.0 : 0.0 );
+
+    return seed;
+}
+
 // VspSurf::SplitTesselate
 // VspSurf::Tesselate
 // VspSurf::TesselateTEforWake
@@ -1574,25 +1644,63 @@ void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::
     unsigned int nu = (unsigned int)u.size();
     unsigned int nv = (unsigned int)v.size();
 
-    vector < vector < surface_point_type > > ptmat, nmat;
-
-    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
-
     // resize pnts and norms
     pnts.resize( nu );
     norms.resize( nu );
     uw_pnts.resize( nu );
-    for ( surface_index_type i = 0; i < nu; ++i )
+
+    // Large grids are evaluated as bands of u concurrently.  Every point only
+    // depends on its own u and v, so the result does not depend on the banding.
+    int nband = 1;
+    if ( nu * nv >= 20000 )
+    {
+        nband = std::min( ( int )nu / 8, 16 );
+    }
+
+    if ( nband > 1 )
+    {
+        ParallelFor( nband, [ & ]( int iband )
+        {
+            TesselateRows( u, v, nu * iband / nband, nu * ( iband + 1 ) / nband, pnts, norms, uw_pnts );
+        } );
+    }
+    else
+    {
+        TesselateRows( u, v, 0, nu, pnts, norms, uw_pnts );
+    }
+}
+
+// VspSurf::TesselateRows
+// Evaluates rows istart to iend - 1 of the grid, the rows must already be allocated.
+void VspSurf::TesselateRows( const vector<double> &u, const vector<double> &v, int istart, int iend, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
+{
+    unsigned int nv = (unsigned int)v.size();
+
+    vector < vector < surface_point_type > > ptmat, nmat;
+
+    if ( istart == 0 && iend == ( int )u.size() )
     {
+        m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
+    }
+    else
+    {
+        vector < double > uband( u.begin() + istart, u.begin() + iend );
+        m_Surface.f_pt_normal_grid( uband, v, ptmat, nmat);
+    }
+
+    for ( int i = istart; i < iend; ++i )
+    {
+        int iband = i - istart;
+
         pnts[i].resize( nv );
         norms[i].resize( nv );
         uw_pnts[i].resize( nv );
 
         for ( surface_index_type j = 0; j < nv; j++ )
         {
-            pnts[i][j] = ptmat[i][j];
+            pnts[i][j] = ptmat[iband][j];
 
-            vec3d norm = nmat[i][j];
+            vec3d norm = nmat[iband][j];
             if ( norm.mag() < 1e-6 ) // Zero normal vector
             {
                 double tmax = GetWMax();
@@ -217,6 +217,14 @@ public:
     void SplitTesselate( int num_u, int num_v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms, const int &n_cap ) const;
     void SplitTesselate( const vector<int> &num_u, int num_v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms, const int &n_cap, const std::vector<int> & umerge = std::vector<int>() ) const;
 
+    //==== Tessellation Reuse ====//
+    // SplitTesselate keys its result by the content hash and the u/w parameters it
+    // evaluates.  A caller whose output already holds the result for a key passes that
+    // key in beforehand, and the evaluation is skipped if the key is unchanged.
+    std::size_t GetContentHash() const;
+    void SetReuseTessKey( std::size_t key ) const                  { m_ReuseTessKey = key; m_LastTessKey = 0; }
+    std::size_t GetLastTessKey() const                             { return m_LastTessKey; }
+
     void TessULine( double u, std::vector< vec3d > & pnts, double tol ) const;
     void TessUFeatureLine( int iu, std::vector< vec3d > & pnts, double tol ) const;
     void TessWFeatureLine( int iw, std::vector< vec3d > & pnts, double tol ) const;
@@ -301,6 +309,7 @@ public:
 protected:
 
     void Tesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
+    void TesselateRows( const vector<double> &utess, const vector<double> &vtess, int istart, int iend, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
     void SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const;
 
     static bool CheckValidPatch( const piecewise_surface_type &surf );
@@ -342,5 +351,8 @@ private:
     mutable vector < double > m_RootCluster;
     mutable vector < double > m_TipCluster;
 
+    mutable std::size_t m_ReuseTessKey;
+    mutable std::size_t m_LastTessKey;
+
 };
 #endif
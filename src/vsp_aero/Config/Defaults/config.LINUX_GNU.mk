@@ -7,7 +7,7 @@ CXX = g++
 
 # These are extra CXXFLAGS and LDFLAGS specific to building the code under `Solver/`.
 SOLVER_CXXFLAGS = -std=c++11 -O3 -funroll-loops -funroll-all-loops -Wno-unused -Wno-format-security -Wno-format-overflow
-SOLVER_LDFLAGS =
+SOLVER_LDFLAGS = -pthread
 ARFLAGS = rcs
 
 # These are extra CXXFLAGS and LDFLAGS specific to building the viewer.